@@ -25,6 +25,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/* === Defines ============================================================= */
+
+/*
+ * Pixels are 4 bits, two to a byte with the left pixel in the high nibble:
+ * the display's own GRAM format, so rows go out without repacking.
+ */
+#define CANVAS_STRIDE(width)    ((width) / 2)
+
 /* === Typedefs ============================================================ */
 
 typedef struct
@@ -33,7 +41,25 @@ typedef struct
 	uint16_t 	height;
 	uint16_t 	width;
 	bool 		dirty;
+
+	/* Bounding box of the pixels changed since the last refresh */
+	uint16_t	dirty_left;
+	uint16_t	dirty_top;
+	uint16_t	dirty_right;	/* exclusive */
+	uint16_t	dirty_bottom;	/* exclusive */
 } Canvas;
 
+/* === Functions =========================================================== */
+
+void canvas_set_pixel(Canvas *canvas, uint16_t x, uint16_t y, uint8_t color);
+uint8_t canvas_get_pixel(const Canvas *canvas, uint16_t x, uint16_t y);
+void canvas_fill_span(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                      uint8_t color);
+void canvas_fill(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                 uint16_t height, uint8_t color);
+void canvas_mark_dirty(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                       uint16_t height);
+void canvas_clean(Canvas *canvas);
+
 #endif
 
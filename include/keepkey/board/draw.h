@@ -60,6 +60,7 @@ void draw_char_simple(Canvas *canvas, const Font *font, char c, uint8_t color, u
 void draw_box(Canvas *canvas, BoxDrawableParams  *params);
 void draw_box_simple(Canvas *canvas, uint8_t color, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
 bool draw_bitmap_mono_rle(Canvas *canvas, const AnimationFrame *frame, bool erase);
+bool draw_delta_frame(Canvas *canvas, const DeltaAnimation *animation, uint16_t frame);
 
 #endif
 
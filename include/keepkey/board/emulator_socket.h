@@ -0,0 +1,47 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMULATOR_SOCKET_H
+#define EMULATOR_SOCKET_H
+
+/* === Includes ============================================================ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Defines ============================================================= */
+
+/* Sockets are numbered like the endpoints they stand in for */
+#define EMULATOR_SOCKET_NORMAL  0
+#define EMULATOR_SOCKET_DEBUG   1
+#define EMULATOR_SOCKET_COUNT   2
+
+/* === Functions =========================================================== */
+
+/*
+ * Kept apart from the rest of the board code, which declares its own
+ * shutdown() and so cannot include the socket headers.
+ */
+bool emulator_socket_open(int sock, uint16_t port);
+bool emulator_socket_wait(int timeout_ms);
+size_t emulator_socket_recv(int sock, uint8_t *buf, size_t len);
+bool emulator_socket_send(int sock, const uint8_t *buf, size_t len);
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FLASH_SIM_H
+#define FLASH_SIM_H
+
+/*
+ * Host model of the STM32F2 flash controller.  It stands in for
+ * <libopencm3/stm32/flash.h> on the emulator: the flash image is mapped at
+ * FLASH_ORIGIN so code that reads flash through its address keeps working,
+ * and the mapping is only writable between flash_unlock() and flash_lock().
+ *
+ * Sectors erase to 0xFF and programming can only clear bits.  Every
+ * operation is charged the typical time from the STM32F205 datasheet, and
+ * each sector counts its erase cycles.
+ */
+
+/* === Includes ============================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Defines ============================================================= */
+
+#define FLASH_SIM_SECTORS       12
+
+/* Program/erase parallelism, as passed to flash_erase_sector() */
+#define FLASH_CR_PROGRAM_X8     0
+#define FLASH_CR_PROGRAM_X16    1
+#define FLASH_CR_PROGRAM_X32    2
+#define FLASH_CR_PROGRAM_X64    3
+
+/* Status register bits, as on the device */
+#define FLASH_SR_EOP            (1 << 0)
+#define FLASH_SR_OPERR          (1 << 1)
+#define FLASH_SR_WRPERR         (1 << 4)
+#define FLASH_SR_PGAERR         (1 << 5)
+#define FLASH_SR_PGPERR         (1 << 6)
+#define FLASH_SR_PGSERR         (1 << 7)
+
+#define FLASH_SR                flash_sim_sr
+
+/* === Typedefs ============================================================ */
+
+typedef struct
+{
+    uint32_t erases[FLASH_SIM_SECTORS];    /* erase cycles per sector */
+    uint64_t bytes_programmed;
+    uint64_t program_ops;                  /* byte or word program operations */
+    uint64_t overwrites;                   /* programs that left a 0 bit set */
+    uint64_t busy_us;                      /* modelled controller busy time */
+} FlashSimStats;
+
+/* === Variables =========================================================== */
+
+extern uint32_t flash_sim_sr;
+
+/* === Functions =========================================================== */
+
+bool flash_sim_init(const char *path);
+void flash_sim_close(void);
+void flash_sim_stats(FlashSimStats *stats);
+void flash_sim_reset_stats(void);
+
+/* libopencm3 flash API */
+void flash_unlock(void);
+void flash_lock(void);
+void flash_clear_status_flags(void);
+void flash_erase_sector(uint8_t sector, uint32_t program_size);
+void flash_program_word(uint32_t address, uint32_t data);
+void flash_program_byte(uint32_t address, uint8_t data);
+void flash_program(uint32_t address, const uint8_t *data, uint32_t len);
+
+#endif
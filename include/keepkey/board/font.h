@@ -26,7 +26,10 @@
 
 /* === Typedefs ============================================================ */
 
-/* Data pertaining to the image of a character */
+/*
+ * Image of a character, 1 bit per pixel.  Rows are packed most significant
+ * bit first and padded to whole bytes; set bits are drawn.
+ */
 typedef struct
 {
     const uint8_t  *data;
@@ -35,20 +38,13 @@ typedef struct
 } CharacterImage;
 
 
-/* Character information. */
-typedef struct
-{
-    long int                code;
-    const CharacterImage   *image;
-} Character;
-
-
-/* A complete font package. */
+/* A complete font package: images indexed by character code from first. */
 typedef struct
 {
-    int                 length;
-    int                 size;
-    const Character    *characters;
+    int                     first;
+    int                     length;
+    int                     size;
+    const CharacterImage   *images;
 } Font;
 
 /* === Functions =========================================================== */
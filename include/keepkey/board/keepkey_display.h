@@ -44,4 +44,9 @@ void display_set_brightness(int percentage);
 void display_turn_on(void);
 void display_turn_off(void);
 
+#ifdef EMULATOR
+uint32_t display_bytes_written(void);
+uint64_t display_bus_cycles(void);
+#endif
+
 #endif
\ No newline at end of file
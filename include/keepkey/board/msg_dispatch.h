@@ -24,58 +24,45 @@
 
 #include "keepkey/transport/interface.h"
 
-#include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /* === Defines ============================================================= */
 
 #define MSG_TINY_BFR_SZ     64
 #define MSG_TINY_TYPE_ERROR 0xFFFF
 
-#define MSG_IN(ID, FIELDS, PROCESS_FUNC, MSG_PERMS) \
-    [ID].msg_perms = (MSG_PERMS), \
-    [ID].msg_id = (ID), \
-    [ID].type = (NORMAL_MSG), \
-    [ID].dir = (IN_MSG), \
-    [ID].fields = (FIELDS), \
-    [ID].dispatch = (PARSABLE), \
-    [ID].process_func = (PROCESS_FUNC),
-
-#define MSG_OUT(ID, FIELDS, PROCESS_FUNC, MSG_PERMS) \
-    [ID].msg_perms = (MSG_PERMS), \
-    [ID].msg_id = (ID), \
-    [ID].type = (NORMAL_MSG), \
-    [ID].dir = (OUT_MSG), \
-    [ID].fields = (FIELDS), \
-    [ID].dispatch = (PARSABLE), \
-    [ID].process_func = (PROCESS_FUNC),
-
-#define RAW_IN(ID, FIELDS, PROCESS_FUNC, MSG_PERMS) \
-    [ID].msg_perms = (MSG_PERMS), \
-    [ID].msg_id = (ID), \
-    [ID].type = (NORMAL_MSG), \
-    [ID].dir = (IN_MSG), \
-    [ID].fields = (FIELDS), \
-    [ID].dispatch = (RAW), \
-    [ID].process_func = (PROCESS_FUNC),
-
-#define DEBUG_IN(ID, FIELDS, PROCESS_FUNC, MSG_PERMS) \
-    [ID].msg_perms = (MSG_PERMS), \
-    [ID].msg_id = (ID), \
-    [ID].type = (DEBUG_MSG), \
-    [ID].dir = (IN_MSG), \
-    [ID].fields = (FIELDS), \
-    [ID].dispatch = (PARSABLE), \
-    [ID].process_func = (PROCESS_FUNC),
-
-#define DEBUG_OUT(ID, FIELDS, PROCESS_FUNC, MSG_PERMS) \
-    [ID].msg_perms = (MSG_PERMS), \
-    [ID].msg_id = (ID), \
-    [ID].type = (DEBUG_MSG), \
-    [ID].dir = (OUT_MSG), \
-    [ID].fields = (FIELDS), \
-    [ID].dispatch = (PARSABLE), \
-    [ID].process_func = (PROCESS_FUNC),
+/* Message map entries, indexed by message id.  NAME is the message's nanopb
+   struct; its id and field table are derived from it. */
+#define MSG_MAP_ENTRY(NAME, PROCESS_FUNC, MSG_PERMS, TYPE, DIR, DISPATCH, DECODE_SIZE) \
+    [MessageType_MessageType_##NAME].msg_perms = (MSG_PERMS), \
+    [MessageType_MessageType_##NAME].msg_id = (MessageType_MessageType_##NAME), \
+    [MessageType_MessageType_##NAME].type = (TYPE), \
+    [MessageType_MessageType_##NAME].dir = (DIR), \
+    [MessageType_MessageType_##NAME].fields = (NAME##_fields), \
+    [MessageType_MessageType_##NAME].dispatch = (DISPATCH), \
+    [MessageType_MessageType_##NAME].process_func = (msg_handler_t)(PROCESS_FUNC), \
+    [MessageType_MessageType_##NAME].decode_size = (DECODE_SIZE),
+
+#define MSG_IN(NAME, PROCESS_FUNC, MSG_PERMS) \
+    MSG_MAP_ENTRY(NAME, PROCESS_FUNC, MSG_PERMS, NORMAL_MSG, IN_MSG, PARSABLE, sizeof(NAME))
+
+#define MSG_OUT(NAME, PROCESS_FUNC, MSG_PERMS) \
+    MSG_MAP_ENTRY(NAME, PROCESS_FUNC, MSG_PERMS, NORMAL_MSG, OUT_MSG, PARSABLE, 0)
+
+#define RAW_IN(NAME, PROCESS_FUNC, MSG_PERMS) \
+    MSG_MAP_ENTRY(NAME, PROCESS_FUNC, MSG_PERMS, NORMAL_MSG, IN_MSG, RAW, 0)
+
+#define DEBUG_IN(NAME, PROCESS_FUNC, MSG_PERMS) \
+    MSG_MAP_ENTRY(NAME, PROCESS_FUNC, MSG_PERMS, DEBUG_MSG, IN_MSG, PARSABLE, sizeof(NAME))
+
+#define DEBUG_OUT(NAME, PROCESS_FUNC, MSG_PERMS) \
+    MSG_MAP_ENTRY(NAME, PROCESS_FUNC, MSG_PERMS, DEBUG_MSG, OUT_MSG, PARSABLE, 0)
+
+/* Union member for each message that gets decoded, for sizing the decode
+   buffer of a message map at compile time */
+#define MSG_DECODE_MEMBER(NAME, PROCESS_FUNC, MSG_PERMS) NAME NAME;
 
 #define NO_PROCESS_FUNC 0
 
@@ -83,6 +70,7 @@
 
 typedef void (*msg_handler_t)(void *ptr);
 typedef void (*msg_failure_t)(FailureType, const char *);
+typedef void (*msg_idle_t)(void);
 typedef bool (*usb_tx_handler_t)(uint8_t *, uint32_t);
 
 #if DEBUG_LINK
@@ -125,6 +113,7 @@ typedef struct
     MessageMapDirection dir;
     MessageType msg_id;
     MessageVariantPerms msg_perms;
+    size_t decode_size;
 } MessagesMap_t;
 
 typedef struct
@@ -151,9 +140,11 @@ bool msg_write(MessageType msg_id, const void *msg);
 bool msg_debug_write(MessageType msg_id, const void *msg);
 #endif
 
-void msg_map_init(const void *map, const size_t size);
+void msg_map_init(const void *map, const size_t size, void *decode_buffer,
+                  size_t decode_buffer_size);
 void set_msg_failure_handler(msg_failure_t failure_func);
 void call_msg_failure_handler(FailureType code, const char *text);
+void set_msg_idle_handler(msg_idle_t idle_func);
 
 #if DEBUG_LINK
 void set_msg_debug_link_get_state_handler(msg_debug_link_get_state_t
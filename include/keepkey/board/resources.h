@@ -29,6 +29,34 @@
 
 /* === Defines ============================================================ */
 
+/* === Typedefs ============================================================ */
+
+/* Changes from the previous frame, see scripts/generate-animations.py */
+typedef struct
+{
+    uint16_t offset;    /* into the animation's data */
+    uint16_t length;
+
+    /* Bounding box of the changed pixels, relative to the animation */
+    uint8_t left;
+    uint8_t top;
+    uint8_t width;
+    uint8_t height;
+} DeltaFrame;
+
+/* An animation whose frames share a rectangle and are stored as deltas */
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t duration;  /* of each frame */
+    uint16_t count;
+    const DeltaFrame *frames;
+    const uint8_t *data;
+} DeltaAnimation;
+
 /* === Functions =========================================================== */
 
 const AnimationFrame *get_confirm_icon_frame(void);
@@ -37,8 +65,8 @@ const AnimationFrame *get_unplug_frame(void);
 const AnimationFrame *get_recovery_frame(void);
 const AnimationFrame *get_warning_frame(void);
 
-const VariantAnimation *get_confirming_animation(void);
-const VariantAnimation *get_loading_animation(void);
+const DeltaAnimation *get_confirming_animation(void);
+const DeltaAnimation *get_loading_animation(void);
 const VariantAnimation *get_warning_animation(void);
 const VariantAnimation *get_logo_animation(void);
 const VariantAnimation *get_logo_reversed_animation(void);
@@ -46,4 +74,7 @@ const VariantAnimation *get_logo_reversed_animation(void);
 uint32_t get_image_animation_duration(const VariantAnimation *animation);
 int get_image_animation_frame(const VariantAnimation *animation,
                                        const uint32_t elapsed, bool loop);
+uint32_t get_delta_animation_duration(const DeltaAnimation *animation);
+int get_delta_animation_frame(const DeltaAnimation *animation,
+                              const uint32_t elapsed, bool loop);
 #endif
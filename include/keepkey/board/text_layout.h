@@ -0,0 +1,68 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+/* === Includes ============================================================ */
+
+#include <stdint.h>
+
+#include "font.h"
+
+/* === Defines ============================================================= */
+
+/*
+ * Lines kept per layout.  Fonts are at least 10 pixels tall, so lines past
+ * this are below the bottom of the display; they are still counted.
+ */
+#define TEXT_LAYOUT_MAX_LINES   16
+
+/* Layouts remembered between calls */
+#define TEXT_LAYOUT_CACHE_SIZE  4
+
+/* Longest string whose layout is remembered; as long as a layout body */
+#define TEXT_LAYOUT_MAX_STRING  352
+
+/* === Typedefs ============================================================ */
+
+/* One line of wrapped text: the characters str[offset .. offset + length) */
+typedef struct
+{
+    uint16_t    offset;
+    uint16_t    length;
+    uint16_t    width;
+} TextLine;
+
+typedef struct
+{
+    /* Key; text_layout() keeps a copy of the string too */
+    const Font *font;
+    uint16_t    line_width;
+    uint16_t    str_length;
+
+    uint32_t    count;      /* may exceed TEXT_LAYOUT_MAX_LINES */
+    TextLine    lines[TEXT_LAYOUT_MAX_LINES];
+} TextLayout;
+
+/* === Functions =========================================================== */
+
+const TextLayout *text_layout(const Font *font, const char *str, uint16_t line_width);
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UPLOAD_SESSION_H
+#define UPLOAD_SESSION_H
+
+/* === Includes ============================================================ */
+
+#include "keepkey/crypto/sha2.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Defines ============================================================= */
+
+/* Largest payload of one chunk of a chunked firmware upload */
+#define UPLOAD_CHUNK_SIZE 1024
+
+/* === Typedefs ============================================================ */
+
+typedef enum
+{
+    UPLOAD_CHUNK_NEW,       /* next chunk of the image; program it */
+    UPLOAD_CHUNK_REPEAT,    /* already accepted; only acknowledge it */
+    UPLOAD_CHUNK_INVALID    /* out of order, too large or past the end */
+} UploadChunkStatus;
+
+/*
+ * State of a chunked firmware upload.  The image is hashed as chunks
+ * arrive, up to the end of the code that the image's meta header
+ * describes, which is what memory_firmware_hash() covers once it is
+ * flashed.
+ */
+typedef struct
+{
+    bool active;
+    uint8_t expected_hash[SHA256_DIGEST_LENGTH];
+    uint32_t length;        /* total image length */
+    uint32_t offset;        /* bytes accepted so far */
+    uint32_t hash_limit;    /* bytes of the image that are hashed */
+    SHA256_CTX ctx;
+} UploadSession;
+
+/* === Functions =========================================================== */
+
+bool upload_session_start(UploadSession *session, const uint8_t *hash,
+                          uint32_t length, uint32_t max_length);
+void upload_session_rebuild(UploadSession *session, const uint8_t *flash);
+UploadChunkStatus upload_session_chunk(UploadSession *session, uint32_t offset,
+                                       const uint8_t *data, uint32_t len);
+bool upload_session_done(const UploadSession *session);
+bool upload_session_verify(UploadSession *session);
+void upload_session_clear(UploadSession *session);
+
+#endif
@@ -53,6 +53,15 @@
    space for it.  */
 #define USBD_CONTROL_BUFFER_SIZE 128
 
+/* Packets that can wait for each IN endpoint before usb_tx() blocks */
+#define USB_TX_QUEUE_DEPTH 32
+
+#ifdef EMULATOR
+/* The emulator carries HID reports as UDP datagrams on localhost, the
+   normal endpoint on this port and the debug link on the next one.  */
+#define EMULATOR_UDP_PORT 21324
+#endif
+
 /* === Typedefs ============================================================ */
 
 typedef struct
@@ -63,6 +72,14 @@ typedef struct
 
 typedef void (*usb_rx_callback_t)(UsbMessage* msg);
 
+typedef struct
+{
+    uint32_t depth;     /* packets queued now */
+    uint32_t max_depth; /* most packets ever queued at once */
+    uint32_t stalls;    /* writes that waited for a full queue */
+    uint32_t packets;   /* packets handed to the endpoint */
+} UsbTxStats;
+
 /* === Functions =========================================================== */
 
 void usb_set_rx_callback(usb_rx_callback_t callback);
@@ -73,9 +90,15 @@ typedef struct _usbd_device usbd_device;
 usbd_device *get_usb_init_stat(void);
 
 bool usb_tx(uint8_t *message, uint32_t len);
+void usb_flush(void);
+void usb_tx_stats(UsbTxStats *stats);
 #if DEBUG_LINK
 bool usb_debug_tx(uint8_t *message, uint32_t len);
 void usb_set_debug_rx_callback(usb_rx_callback_t callback);
 #endif
 
+#ifdef EMULATOR
+bool usb_record(const char *path);
+#endif
+
 #endif
@@ -62,6 +62,12 @@ void handler_ping(Ping* msg);
 void handler_erase(FirmwareErase* msg);
 void handler_wipe(WipeDevice* msg);
 void raw_handler_upload(RawMessage *msg, uint32_t frame_length);
+void handler_upload_start(FirmwareUploadStart *msg);
+void handler_upload_chunk(FirmwareUploadChunk *msg);
+
+#ifdef EMULATOR
+bool usb_flash_reset_upload(void);
+#endif
 
 #if DEBUG_LINK
 void handler_debug_link_get_state(DebugLinkGetState *msg);
@@ -120,8 +120,19 @@ void bn_mult_k(bignum256 *x, uint8_t k, const bignum256 *prime);
 
 void bn_mod(bignum256 *x, const bignum256 *prime);
 
+// Reduces the 18 limb product of bn_multiply_long modulo prime into x.
+// assumes    res normalized, res < 2^270 * 2 * prime
+// guarantees x partly reduced, i.e., x < 2 * prime
+typedef void (*bn_reduce_func)(bignum256 *x, uint32_t res[18], const bignum256 *prime);
+
+void bn_multiply_long(const bignum256 *k, const bignum256 *x, uint32_t res[18]);
+
+void bn_multiply_reduce(bignum256 *x, uint32_t res[18], const bignum256 *prime);
+
 void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime);
 
+void bn_multiply_with(const bignum256 *k, bignum256 *x, const bignum256 *prime, bn_reduce_func reduce);
+
 void bn_fast_mod(bignum256 *x, const bignum256 *prime);
 
 void bn_sqrt(bignum256 *x, const bignum256 *prime);
@@ -55,12 +55,18 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i);
 
 int hdnode_public_ckd(HDNode *inout, uint32_t i);
 
+int hdnode_public_ckd_batch(HDNode *inout, const uint32_t *i, size_t count);
+
 int hdnode_public_ckd_address_optimized(const curve_point *pub, const uint8_t *public_key, const uint8_t *chain_code, uint32_t i, uint8_t version, char *addr, int addrsize);
 
 #if USE_BIP32_CACHE
 
 int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count);
 
+void hdnode_private_ckd_cache_clear(void);
+
+void hdnode_private_ckd_cache_stats(uint32_t *hits, uint32_t *misses);
+
 #endif
 
 uint32_t hdnode_fingerprint(HDNode *node);
@@ -33,6 +33,11 @@ typedef struct {
 	bignum256 x, y;
 } curve_point;
 
+// curve point in jacobian coordinates: (x/z^2, y/z^3)
+typedef struct jacobian_curve_point {
+	bignum256 x, y, z;
+} jacobian_curve_point;
+
 typedef struct {
 
 	bignum256 prime;       // prime order of the finite field
@@ -41,6 +46,7 @@ typedef struct {
 	bignum256 order_half;  // order of G divided by 2
 	int       a;           // coefficient 'a' of the elliptic curve
 	bignum256 b;           // coefficient 'b' of the elliptic curve
+	bn_reduce_func multiply_reduce; // field reduction for bn_multiply_with
 
 #if USE_PRECOMPUTED_CP
 	const curve_point cp[64][8];
@@ -70,6 +76,11 @@ int point_is_infinity(const curve_point *p);
 int point_is_equal(const curve_point *p, const curve_point *q);
 int point_is_negative_of(const curve_point *p, const curve_point *q);
 void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *res);
+void ecdsa_double_scalar_multiply(const ecdsa_curve *curve, const bignum256 *k1, const bignum256 *k2, const curve_point *p, curve_point *res);
+void scalar_multiply_add_batch(const ecdsa_curve *curve, const bignum256 *k, const curve_point *p, curve_point *res, int n);
+void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp, const ecdsa_curve *curve);
+void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p, const ecdsa_curve *curve);
+void jacobian_to_curve_batch(const jacobian_curve_point *jp, curve_point *p, int n, const ecdsa_curve *curve);
 void uncompress_coords(const ecdsa_curve *curve, uint8_t odd, const bignum256 *x, bignum256 *y);
 int ecdsa_uncompress_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key, uint8_t *uncompressed);
 
@@ -46,8 +46,16 @@
 // implement BIP32 caching
 #ifndef USE_BIP32_CACHE
 #define USE_BIP32_CACHE 1
-#define BIP32_CACHE_SIZE 10
-#define BIP32_CACHE_MAXDEPTH 8
+#endif
+
+// memory in bytes given to the BIP32 node cache
+#ifndef BIP32_CACHE_BUDGET
+#define BIP32_CACHE_BUDGET 2048
+#endif
+
+// number of points normalized together by batched public derivation
+#ifndef ECDSA_BATCH_SIZE
+#define ECDSA_BATCH_SIZE 8
 #endif
 
 // implement BIP39 caching
@@ -61,6 +61,7 @@ int cryptoMessageDecrypt(curve_point *nonce, uint8_t *payload, size_t payload_le
 */
 
 uint8_t *cryptoHDNodePathToPubkey(const HDNodePathType *hdnodepath);
+int cryptoMultisigPubkeys(const MultisigRedeemScriptType *multisig, uint8_t pubkeys[][33]);
 int cryptoMultisigPubkeyIndex(const MultisigRedeemScriptType *multisig,
                               const uint8_t *pubkey);
 int cryptoMultisigFingerprint(const MultisigRedeemScriptType *multisig, uint8_t *hash);
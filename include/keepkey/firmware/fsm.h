@@ -36,6 +36,7 @@
 
 #define BTC_ADDRESS_SIZE           35
 #define RAW_TX_ACK_VARINT_COUNT    4
+#define GET_ADDRESSES_MAX_COUNT    1000
 
 /* === Functions =========================================================== */
 
@@ -66,6 +67,7 @@ void fsm_msgClearSession(ClearSession *msg);
 void fsm_msgApplySettings(ApplySettings *msg);
 //void fsm_msgButtonAck(ButtonAck *msg);
 void fsm_msgGetAddress(GetAddress *msg);
+void fsm_msgGetAddresses(GetAddresses *msg);
 void fsm_msgEntropyAck(EntropyAck *msg);
 void fsm_msgSignMessage(SignMessage *msg);
 void fsm_msgVerifyMessage(VerifyMessage *msg);
@@ -40,6 +40,7 @@ void next_character(void);
 void recovery_character(const char *character);
 void recovery_delete_character(void);
 void recovery_cipher_finalize(void);
+bool recovery_cipher_in_progress(void);
 bool recovery_cipher_abort(void);
 
 #if DEBUG_LINK
@@ -41,6 +41,7 @@
 void reset_init(bool display_random, uint32_t _strength, bool passphrase_protection,
                 bool pin_protection, const char *language, const char *label);
 void reset_entropy(const uint8_t *ext_entropy, uint32_t len);
+bool reset_in_progress(void);
 uint32_t reset_get_int_entropy(uint8_t *entropy);
 const char *reset_get_word(void);
 
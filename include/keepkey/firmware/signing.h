@@ -36,6 +36,15 @@
 #define PROGRESS_PRECISION 16
 #define VAR_INT_BUFFER 8
 
+/* Bytes of phase 1 data (blank inputs and serialized outputs) kept in RAM
+ * so that phase 2 can finish every input's sighash without re-streaming the
+ * whole transaction.  Larger transactions fall back to streaming.  Each input
+ * entry is its prevout and sequence, then a digest of the whole TxInputType
+ * that phase 2 checks before signing it.
+ */
+#define SIGHASH_CACHE_SIZE (10 * 1024)
+#define SIGHASH_CACHE_INPUT_SIZE (36 + 4 + 32)
+
 /* === Functions =========================================================== */
 
 void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinType *_coin, const HDNode *_root, uint32_t _version, uint32_t _lock_time);
@@ -24,8 +24,9 @@
 #include "keepkey/board/memory.h"
 #include "keepkey/firmware/storagepb.h"
 
-#define STORAGE_VERSION 10 /* Must add case fallthrough in storage_from_flash after increment*/
+#define STORAGE_VERSION 11 /* Must add case fallthrough in storage_from_flash after increment*/
 #define STORAGE_RETRIES 3
+#define STORAGE_COMMIT_DELAY_MS 500 /* Deferred commits wait this long for more changes */
 
 typedef struct _HDNode HDNode;
 typedef struct _HDNodeType HDNodeType;
@@ -41,6 +42,9 @@ void storage_reset_uuid(void);
 void storage_reset(void);
 void session_clear(bool clear_pin);
 void storage_commit(void);
+void storage_mark_dirty(void);
+void storage_flush(void);
+void storage_poll(void);
 
 void storage_dumpNode(HDNodeType *dst, const StorageHDNode *src);
 void storage_load_device(LoadDevice *msg);
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STORAGE_LOG_H
+#define STORAGE_LOG_H
+
+/*
+ storage sector layout:
+
+ offset              |  description
+---------------------+-----------------------------------------------
+ 0x0000              |  ConfigFlash snapshot, magic written last
+ STORAGE_LOG_START   |  log records, oldest first
+ ...                 |  erased (0xFF) up to the end of the sector
+
+ Each record is a word-aligned StorageLogRecord followed by segments that
+ overwrite bytes of the snapshot.  A record is replayed only if its CRC
+ matches, so a commit interrupted by reset is dropped as a whole.
+ */
+
+/* === Includes ============================================================ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Defines ============================================================= */
+
+#define STORAGE_LOG_TAG     0x4C53  /* "SL" */
+
+/* === Typedefs ============================================================ */
+
+typedef struct
+{
+    uint32_t crc;       /* calc_crc32() of the rest of the record */
+    uint16_t len;       /* bytes of segments that follow, before padding */
+    uint16_t tag;
+} StorageLogRecord;
+
+typedef struct
+{
+    uint16_t offset;    /* into ConfigFlash */
+    uint16_t len;       /* bytes of data that follow */
+} StorageLogSegment;
+
+/* === Functions =========================================================== */
+
+bool storage_log_encode(uint32_t *record, size_t record_size, const uint8_t *from,
+                        const uint8_t *to, size_t len, size_t *record_len);
+bool storage_log_replay(const uint8_t *log, size_t log_size, uint8_t *config,
+                        size_t config_len, size_t *log_len);
+
+#endif
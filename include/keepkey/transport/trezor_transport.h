@@ -70,12 +70,6 @@ typedef struct
     uint8_t contents[0];
 } TrezorFrame;
 
-typedef struct
-{
-    TrezorFrame frame;
-    uint8_t buffer[MAX_FRAME_SIZE];
-} TrezorFrameBuffer;
-
 #pragma pack()
 
 #endif
\ No newline at end of file
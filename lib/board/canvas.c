@@ -0,0 +1,202 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/board/canvas.h"
+
+#include <string.h>
+
+#pragma GCC push_options
+#pragma GCC optimize("-O3")
+
+/* === Functions =========================================================== */
+
+/*
+ * canvas_set_pixel() - Set one pixel.  Colors are 8 bit intensities, of
+ * which the canvas keeps the top 4 bits.
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: column, less than canvas width
+ *     - y: row, less than canvas height
+ *     - color: intensity
+ * OUTPUT
+ *     none
+ */
+void canvas_set_pixel(Canvas *canvas, uint16_t x, uint16_t y, uint8_t color)
+{
+    uint8_t *pair = &canvas->buffer[y * CANVAS_STRIDE(canvas->width) + x / 2];
+
+    if(x & 1)
+    {
+        *pair = (*pair & 0xF0) | (color >> 4);
+    }
+    else
+    {
+        *pair = (*pair & 0x0F) | (color & 0xF0);
+    }
+}
+
+/*
+ * canvas_get_pixel() - Get one pixel
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: column, less than canvas width
+ *     - y: row, less than canvas height
+ * OUTPUT
+ *     intensity, scaled back to 8 bits
+ */
+uint8_t canvas_get_pixel(const Canvas *canvas, uint16_t x, uint16_t y)
+{
+    uint8_t pair = canvas->buffer[y * CANVAS_STRIDE(canvas->width) + x / 2];
+    uint8_t nibble = (x & 1) ? (pair & 0x0F) : (pair >> 4);
+
+    return(nibble * 0x11);
+}
+
+/*
+ * canvas_fill_span() - Fill part of one row.  Whole bytes are set at once,
+ * so only odd edge pixels cost a read.
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: left column
+ *     - y: row, less than canvas height
+ *     - width: width in pixels, with x + width at most canvas width
+ *     - color: intensity
+ * OUTPUT
+ *     none
+ */
+void canvas_fill_span(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                      uint8_t color)
+{
+    uint8_t pair = (color & 0xF0) | (color >> 4);
+    uint16_t right = x + width;
+
+    if(x & 1)
+    {
+        canvas_set_pixel(canvas, x++, y, color);
+    }
+
+    if(right > x && (right & 1))
+    {
+        canvas_set_pixel(canvas, --right, y, color);
+    }
+
+    if(right > x)
+    {
+        memset(&canvas->buffer[y * CANVAS_STRIDE(canvas->width) + x / 2], pair,
+               (right - x) / 2);
+    }
+}
+
+/*
+ * canvas_fill() - Fill a rectangle, clipped to the canvas
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: left column
+ *     - y: top row
+ *     - width: width in pixels
+ *     - height: height in pixels
+ *     - color: intensity
+ * OUTPUT
+ *     none
+ */
+void canvas_fill(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                 uint16_t height, uint8_t color)
+{
+    uint16_t row;
+
+    if(x >= canvas->width || y >= canvas->height)
+    {
+        return;
+    }
+
+    width = (width > canvas->width - x) ? canvas->width - x : width;
+    height = (height > canvas->height - y) ? canvas->height - y : height;
+
+    for(row = y; row < y + height; row++)
+    {
+        canvas_fill_span(canvas, x, row, width, color);
+    }
+}
+
+/*
+ * canvas_mark_dirty() - Add a rectangle, clipped to the canvas, to the
+ * area the next display refresh sends
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: left column
+ *     - y: top row
+ *     - width: width in pixels
+ *     - height: height in pixels
+ * OUTPUT
+ *     none
+ */
+void canvas_mark_dirty(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                       uint16_t height)
+{
+    uint16_t right, bottom;
+
+    if(x >= canvas->width || y >= canvas->height || width == 0 || height == 0)
+    {
+        return;
+    }
+
+    right = (width > canvas->width - x) ? canvas->width : x + width;
+    bottom = (height > canvas->height - y) ? canvas->height : y + height;
+
+    if(!canvas->dirty)
+    {
+        canvas->dirty_left = x;
+        canvas->dirty_top = y;
+        canvas->dirty_right = right;
+        canvas->dirty_bottom = bottom;
+        canvas->dirty = true;
+        return;
+    }
+
+    canvas->dirty_left = (x < canvas->dirty_left) ? x : canvas->dirty_left;
+    canvas->dirty_top = (y < canvas->dirty_top) ? y : canvas->dirty_top;
+    canvas->dirty_right = (right > canvas->dirty_right) ? right : canvas->dirty_right;
+    canvas->dirty_bottom = (bottom > canvas->dirty_bottom) ? bottom : canvas->dirty_bottom;
+}
+
+/*
+ * canvas_clean() - Forget the changed area once the display shows it
+ *
+ * INPUT
+ *     - canvas: canvas
+ * OUTPUT
+ *     none
+ */
+void canvas_clean(Canvas *canvas)
+{
+    canvas->dirty = false;
+    canvas->dirty_left = 0;
+    canvas->dirty_top = 0;
+    canvas->dirty_right = 0;
+    canvas->dirty_bottom = 0;
+}
+
+#pragma GCC pop_options
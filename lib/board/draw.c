@@ -21,6 +21,7 @@
 #include "keepkey/board/keepkey_display.h"
 #include "keepkey/board/font.h"
 #include "keepkey/board/resources.h"
+#include "keepkey/board/text_layout.h"
 #include "keepkey/firmware/fsm.h"
 
 #include <assert.h>
@@ -47,13 +48,11 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
 {
     bool ret_stat = false;
 
-    uint16_t start_index = (p->y * canvas->width) + p->x;
-    /* Check start_index, p->x, p->y are within bounds */
-    if (start_index >= (KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH)){
+    /* Check p->x, p->y are within bounds */
+    if(p->x >= canvas->width || p->y >= canvas->height)
+    {
         return false;
     }
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-    uint8_t *canvas_end = &canvas->buffer[canvas->width * canvas->height];
 
     /* Check that this was a character that we have in the font */
     if(img != NULL)
@@ -62,27 +61,41 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
         if(((img->width + p->x) <= canvas->width) &&
                 ((img->height + p->y) <= canvas->height))
         {
-            const uint8_t *img_pixel = &img->data[ 0 ];
-
+            const uint8_t *row_data = img->data;
+            uint16_t stride = (img->width + 7) / 8;
             int y;
 
-            for(y = 0; y < img->height; y++)
+            /* Fill each run of set bits in a row as one span */
+            for(y = 0; y < img->height; y++, row_data += stride)
             {
-                int x;
+                int x = 0;
 
-                for(x = 0; x < img->width; x++)
+                while(x < img->width)
                 {
-                    if (canvas_pixel >= canvas_end){
-                        return false; // defensive bounds check
+                    int start;
+
+                    while(x < img->width && !(row_data[x / 8] & (0x80 >> (x % 8))))
+                    {
+                        x++;
                     }
-                    *canvas_pixel = (*img_pixel == 0x00) ? p->color : *canvas_pixel;
-                    canvas_pixel++;
-                    img_pixel++;
-                }
 
-                canvas_pixel += (canvas->width - img->width);
+                    start = x;
+
+                    while(x < img->width && (row_data[x / 8] & (0x80 >> (x % 8))))
+                    {
+                        x++;
+                    }
+
+                    if(x > start)
+                    {
+                        canvas_fill_span(canvas, p->x + start, p->y + y, x - start,
+                                         p->color);
+                    }
+                }
             }
 
+            canvas_mark_dirty(canvas, p->x, p->y, img->width, img->height);
+
             if(x_shift != NULL)
             {
                 *x_shift += img->width;
@@ -97,8 +110,6 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
         }
     }
 
-    canvas->dirty = true;
-
     return(ret_stat);
 }
 
@@ -118,60 +129,36 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
 void draw_string(Canvas *canvas, const Font *font, const char *str_write,
                  DrawableParams *p, uint16_t width, uint16_t line_height)
 {
-    bool have_space = true;
-    uint16_t x_offset = 0;
+    bool wrap = (width != 0) && (width <= canvas->width);
+    const TextLayout *layout = text_layout(font, str_write, wrap ? width : 0);
     DrawableParams char_params = *p;
+    uint32_t line_count = layout->count;
+    uint32_t line;
+
+    if(line_count > TEXT_LAYOUT_MAX_LINES)
+    {
+        line_count = TEXT_LAYOUT_MAX_LINES;
+    }
 
-    while(*str_write && have_space)
+    for(line = 0; line < line_count; line++)
     {
-        const CharacterImage *img = font_get_char(font, *str_write);
-        uint16_t word_width = img->width;
-        char *next_c = (char *)str_write + 1;
+        const TextLine *text_line = &layout->lines[ line ];
+        const char *c = str_write + text_line->offset;
+        uint16_t x_offset = 0;
 
-        /* Allow line breaks */
-        if(*str_write == '\n')
-        {
-            char_params.y += line_height;
-            x_offset = 0;
-            str_write++;
-            continue;
-        }
+        char_params.y = p->y + line * line_height;
 
-        /*
-         * Calculate the next word width while
-         * removing spacings at beginning of lines
-         */
-        if(*str_write == ' ')
+        for(; c < str_write + text_line->offset + text_line->length; c++)
         {
+            char_params.x = x_offset + p->x;
 
-            while(*next_c && *next_c != ' ' && *next_c != '\n')
+            if(!draw_char_with_shift(canvas, &char_params, &x_offset, NULL,
+                                     font_get_char(font, *c)))
             {
-                word_width += font_get_char(font, *next_c)->width;
-                next_c++;
+                return;
             }
         }
-
-        /* Determine if we need a line break */
-        if((width != 0) && (width <= canvas->width) && (x_offset + word_width > width))
-        {
-            char_params.y += line_height;
-            x_offset = 0;
-        }
-
-        /* Remove spaces from beginning of of line */
-        if(x_offset == 0 && *str_write == ' ')
-        {
-            str_write++;
-            continue;
-        }
-
-        /* Draw Character */
-        char_params.x = x_offset + p->x;
-        have_space = draw_char_with_shift(canvas, &char_params, &x_offset, NULL, img);
-        str_write++;
     }
-
-    canvas->dirty = true;
 }
 
 /*
@@ -192,8 +179,6 @@ void draw_char(Canvas *canvas, const Font *font, char c, DrawableParams *p)
 
     /* Draw Character */
     draw_char_with_shift(canvas, p, &x_offset, NULL, img);
-
-    canvas->dirty = true;
 }
 
 /*
@@ -240,30 +225,11 @@ void draw_box(Canvas *canvas, BoxDrawableParams *p)
     uint16_t end_col = p->base.x + p->width;
     end_col = (end_col >= canvas->width) ? canvas->width - 1 : end_col;
 
-    uint16_t start_index = (start_row * canvas->width) + start_col;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-    uint8_t *canvas_end = &canvas->buffer[canvas->width * canvas->height];
-
     uint16_t height = end_row - start_row;
     uint16_t width = end_col - start_col;
 
-
-
-    for(uint16_t y = 0; y < height; y++)
-    {
-        for(uint16_t x = 0; x < width; x++)
-        {
-            if (canvas_pixel >= canvas_end){
-                return; // defensive bounds check
-            }
-            *canvas_pixel = p->base.color;
-            canvas_pixel++;
-        }
-
-        canvas_pixel += (canvas->width - width);
-    }
-
-    canvas->dirty = true;
+    canvas_fill(canvas, start_col, start_row, width, height, p->base.color);
+    canvas_mark_dirty(canvas, start_col, start_row, width, height);
 }
 
 /*
@@ -341,8 +307,8 @@ bool draw_bitmap_mono_rle(Canvas *canvas, const AnimationFrame *frame, bool eras
                 return false; // defensive bounds check
             }
 
-            const uint32_t canvas_index = ((frame->y + y0) * canvas->width) + frame->x + x0;
-            canvas->buffer[canvas_index] = (uint8_t)((int)img->data[pixel_index] * color / 100);
+            canvas_set_pixel(canvas, frame->x + x0, frame->y + y0,
+                             (uint8_t)((int)img->data[pixel_index] * color / 100));
 
             if(sequence > 0)
             {
@@ -361,7 +327,72 @@ bool draw_bitmap_mono_rle(Canvas *canvas, const AnimationFrame *frame, bool eras
         }
     }
 
-    canvas->dirty = true;
+    canvas_mark_dirty(canvas, frame->x, frame->y, img->w, img->h);
+    return true;
+}
+
+/*
+ * draw_delta_frame() - Apply one frame of a delta animation
+ *
+ *     Only the pixels that differ from the previous frame are written, so the
+ *     canvas must already show that frame, or a blank rectangle for frame 0.
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - animation: delta animation
+ *     - frame: number of the frame
+ * OUTPUT
+ *     true/false whether frame was drawn
+ */
+bool draw_delta_frame(Canvas *canvas, const DeltaAnimation *animation, uint16_t frame)
+{
+    if(frame >= animation->count ||
+            (animation->w + animation->x) > canvas->width ||
+            (animation->h + animation->y) > canvas->height)
+    {
+        return false;
+    }
+
+    const DeltaFrame *delta = &animation->frames[frame];
+    const uint8_t *run = &animation->data[delta->offset];
+    const uint8_t *end = run + delta->length;
+    uint32_t area = (uint32_t)animation->w * animation->h;
+    uint32_t pos = 0;
+
+    while(run + 2 <= end)
+    {
+        uint8_t count = run[1];
+        const uint8_t *values = &run[2];
+
+        pos += run[0];
+        run += 2 + (count + 1) / 2;
+
+        if(run > end || pos + count > area)
+        {
+            return false; // defensive bounds check
+        }
+
+        uint16_t x = pos % animation->w;
+        uint16_t y = pos / animation->w;
+
+        for(int i = 0; i < count; i++)
+        {
+            uint8_t color = (i & 1) ? values[i / 2] << 4 : values[i / 2] & 0xF0;
+
+            canvas_set_pixel(canvas, animation->x + x, animation->y + y, color);
+
+            if(++x == animation->w)
+            {
+                x = 0;
+                y++;
+            }
+        }
+
+        pos += count;
+    }
+
+    canvas_mark_dirty(canvas, animation->x + delta->left, animation->y + delta->top,
+                      delta->width, delta->height);
     return true;
 }
 #pragma GCC pop_options
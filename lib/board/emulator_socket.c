@@ -0,0 +1,168 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/board/emulator_socket.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* === Private Variables =================================================== */
+
+typedef struct
+{
+    int fd;
+    struct sockaddr_in peer;
+    bool has_peer;
+} EmulatorSocket;
+
+static EmulatorSocket sockets[EMULATOR_SOCKET_COUNT] = {
+    { .fd = -1 },
+    { .fd = -1 },
+};
+
+/* === Functions =========================================================== */
+
+/*
+ * emulator_socket_open() - Bind a nonblocking UDP socket on localhost
+ *
+ * INPUT
+ *     - sock: socket number
+ *     - port: UDP port
+ * OUTPUT
+ *     true/false whether the socket is ready
+ */
+bool emulator_socket_open(int sock, uint16_t port)
+{
+    EmulatorSocket *s = &sockets[sock];
+    struct sockaddr_in addr;
+
+    if(s->fd >= 0)
+    {
+        return(true);
+    }
+
+    s->fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+
+    if(s->fd < 0)
+    {
+        return(false);
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+
+    if(bind(s->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        close(s->fd);
+        s->fd = -1;
+        return(false);
+    }
+
+    return(true);
+}
+
+/*
+ * emulator_socket_wait() - Wait for a datagram on any open socket
+ *
+ * INPUT
+ *     - timeout_ms: longest wait
+ * OUTPUT
+ *     true/false whether a datagram is ready
+ */
+bool emulator_socket_wait(int timeout_ms)
+{
+    struct pollfd fds[EMULATOR_SOCKET_COUNT];
+    nfds_t nfds = 0;
+
+    for(int i = 0; i < EMULATOR_SOCKET_COUNT; i++)
+    {
+        if(sockets[i].fd >= 0)
+        {
+            fds[nfds].fd = sockets[i].fd;
+            fds[nfds++].events = POLLIN;
+        }
+    }
+
+    return(nfds > 0 && poll(fds, nfds, timeout_ms) > 0);
+}
+
+/*
+ * emulator_socket_recv() - Read one pending datagram. Its sender becomes
+ * the peer that replies go to.
+ *
+ * INPUT
+ *     - sock: socket number
+ *     - buf: destination buffer
+ *     - len: size of buffer
+ * OUTPUT
+ *     datagram size, 0 when none is pending
+ */
+size_t emulator_socket_recv(int sock, uint8_t *buf, size_t len)
+{
+    EmulatorSocket *s = &sockets[sock];
+    struct sockaddr_in peer;
+    socklen_t peer_len = sizeof(peer);
+
+    if(s->fd < 0)
+    {
+        return(0);
+    }
+
+    ssize_t rx = recvfrom(s->fd, buf, len, 0, (struct sockaddr *)&peer, &peer_len);
+
+    if(rx <= 0)
+    {
+        return(0);
+    }
+
+    s->peer = peer;
+    s->has_peer = true;
+    return((size_t)rx);
+}
+
+/*
+ * emulator_socket_send() - Send one datagram to the current peer
+ *
+ * INPUT
+ *     - sock: socket number
+ *     - buf: datagram
+ *     - len: size of datagram
+ * OUTPUT
+ *     true/false whether it was sent
+ */
+bool emulator_socket_send(int sock, const uint8_t *buf, size_t len)
+{
+    EmulatorSocket *s = &sockets[sock];
+
+    if(s->fd < 0 || !s->has_peer)
+    {
+        return(false);
+    }
+
+    return(sendto(s->fd, buf, len, 0, (struct sockaddr *)&s->peer,
+                  sizeof(s->peer)) == (ssize_t)len);
+}
@@ -0,0 +1,411 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/board/flash_sim.h"
+#include "keepkey/board/memory.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#  define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+/* === Private Variables =================================================== */
+
+/* A backing file keeps the statistics after the image, so wear carries over */
+#define FLASH_SIM_TRAILER_LEN   4096
+
+/* Typical program time of one byte (x8) or word (x32) */
+#define FLASH_SIM_PROGRAM_US    16
+
+_Static_assert(sizeof(FlashSimStats) <= FLASH_SIM_TRAILER_LEN,
+               "flash statistics must fit the file trailer");
+
+typedef struct
+{
+    uint32_t len;
+    uint32_t erase_us[4];   /* by parallelism: x8, x16, x32, x64 */
+} EraseTime;
+
+static const EraseTime erase_times[] =
+{
+    { 0x4000,  {  400000,  300000,  250000,  250000 } },
+    { 0x10000, { 1200000,  700000,  550000,  550000 } },
+    { 0x20000, { 2000000, 1300000, 1000000, 1000000 } },
+};
+
+uint32_t flash_sim_sr;
+
+static uint8_t *flash_mem = NULL;
+static int flash_fd = -1;
+static bool flash_unlocked = false;
+static FlashSimStats local_stats;
+static FlashSimStats *stats = &local_stats;
+
+/* === Private Functions =================================================== */
+
+/*
+ * flash_sim_writable() - Change whether the flash mapping can be written
+ *
+ * INPUT
+ *     - writable: true between unlock and lock
+ * OUTPUT
+ *     true/false whether the protection was changed
+ */
+static bool flash_sim_writable(bool writable)
+{
+    return(mprotect(flash_mem, FLASH_TOTAL_SIZE,
+                    writable ? PROT_READ | PROT_WRITE : PROT_READ) == 0);
+}
+
+/*
+ * flash_sim_ready() - Check that a program operation may go ahead, and
+ * latch the error the controller would report if not
+ *
+ * INPUT
+ *     - address: first byte to program
+ *     - len: number of bytes
+ * OUTPUT
+ *     true/false whether the bytes can be programmed
+ */
+static bool flash_sim_ready(uint32_t address, uint32_t len)
+{
+    if(flash_mem == NULL || !flash_unlocked ||
+            address < FLASH_ORIGIN || address + len > FLASH_END)
+    {
+        flash_sim_sr |= FLASH_SR_PGSERR;
+        return(false);
+    }
+
+    if(address % len)
+    {
+        flash_sim_sr |= FLASH_SR_PGAERR;
+        return(false);
+    }
+
+    return(true);
+}
+
+/*
+ * flash_sim_program() - Program bytes.  Like the real cells, a program can
+ * only clear bits; a 1 over a 0 stays 0.
+ *
+ * INPUT
+ *     - address: first byte to program
+ *     - data: source data
+ *     - len: number of bytes in one program operation
+ * OUTPUT
+ *     none
+ */
+static void flash_sim_program(uint32_t address, const uint8_t *data, uint32_t len)
+{
+    uint8_t *dst = flash_mem + (address - FLASH_ORIGIN);
+    bool overwrite = false;
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        uint8_t cell = dst[i] & data[i];
+        overwrite |= cell != data[i];
+        dst[i] = cell;
+    }
+
+    stats->bytes_programmed += len;
+    stats->program_ops++;
+    stats->busy_us += FLASH_SIM_PROGRAM_US;
+
+    if(overwrite)
+    {
+        stats->overwrites++;
+    }
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * flash_sim_init() - Map a blank or saved flash image at FLASH_ORIGIN
+ *
+ * INPUT
+ *     - path: backing file, created if missing and padded with erased
+ *       flash if short; NULL for a blank image that is not saved
+ * OUTPUT
+ *     true/false whether flash is mapped
+ */
+bool flash_sim_init(const char *path)
+{
+    struct stat st;
+    void *mem;
+
+    flash_sim_close();
+
+    if(path == NULL)
+    {
+        mem = mmap((void *)FLASH_ORIGIN, FLASH_TOTAL_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        st.st_size = 0;
+    }
+    else
+    {
+        flash_fd = open(path, O_RDWR | O_CREAT, 0600);
+
+        if(flash_fd < 0 || fstat(flash_fd, &st) != 0 ||
+                ftruncate(flash_fd, FLASH_TOTAL_SIZE + FLASH_SIM_TRAILER_LEN) != 0)
+        {
+            flash_sim_close();
+            return(false);
+        }
+
+        mem = mmap((void *)FLASH_ORIGIN, FLASH_TOTAL_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_FIXED_NOREPLACE, flash_fd, 0);
+    }
+
+    /* Older kernels take the address as a hint only */
+    if(mem != (void *)FLASH_ORIGIN)
+    {
+        if(mem != MAP_FAILED)
+        {
+            munmap(mem, FLASH_TOTAL_SIZE);
+        }
+
+        flash_sim_close();
+        return(false);
+    }
+
+    flash_mem = mem;
+
+    if(st.st_size < FLASH_TOTAL_SIZE)
+    {
+        memset(flash_mem + st.st_size, 0xFF, FLASH_TOTAL_SIZE - st.st_size);
+    }
+
+    if(path != NULL)
+    {
+        mem = mmap(NULL, FLASH_SIM_TRAILER_LEN, PROT_READ | PROT_WRITE,
+                   MAP_SHARED, flash_fd, FLASH_TOTAL_SIZE);
+
+        if(mem == MAP_FAILED)
+        {
+            flash_sim_close();
+            return(false);
+        }
+
+        stats = mem;
+    }
+
+    flash_sim_sr = 0;
+    return(flash_sim_writable(false));
+}
+
+/*
+ * flash_sim_close() - Unmap flash, saving it if it has a backing file
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void flash_sim_close(void)
+{
+    if(stats != &local_stats)
+    {
+        munmap(stats, FLASH_SIM_TRAILER_LEN);
+    }
+
+    if(flash_mem != NULL)
+    {
+        munmap(flash_mem, FLASH_TOTAL_SIZE);
+    }
+
+    if(flash_fd >= 0)
+    {
+        close(flash_fd);
+    }
+
+    memset(&local_stats, 0, sizeof(local_stats));
+    stats = &local_stats;
+    flash_mem = NULL;
+    flash_fd = -1;
+    flash_unlocked = false;
+}
+
+/*
+ * flash_sim_stats() - Get wear counters and modelled timing
+ *
+ * INPUT
+ *     - out: destination for the statistics
+ * OUTPUT
+ *     none
+ */
+void flash_sim_stats(FlashSimStats *out)
+{
+    memcpy(out, stats, sizeof(*out));
+}
+
+/*
+ * flash_sim_reset_stats() - Zero wear counters and modelled timing
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void flash_sim_reset_stats(void)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+/*
+ * flash_unlock() - Allow erase and program operations
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void flash_unlock(void)
+{
+    if(flash_mem != NULL && !flash_unlocked)
+    {
+        flash_unlocked = flash_sim_writable(true);
+    }
+}
+
+/*
+ * flash_lock() - Refuse erase and program operations
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void flash_lock(void)
+{
+    if(flash_mem != NULL && flash_unlocked)
+    {
+        flash_sim_writable(false);
+    }
+
+    flash_unlocked = false;
+}
+
+/*
+ * flash_clear_status_flags() - Clear latched errors
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void flash_clear_status_flags(void)
+{
+    flash_sim_sr = 0;
+}
+
+/*
+ * flash_erase_sector() - Set a whole sector to 0xFF
+ *
+ * INPUT
+ *     - sector: sector number
+ *     - program_size: FLASH_CR_PROGRAM_X8 .. FLASH_CR_PROGRAM_X64
+ * OUTPUT
+ *     none
+ */
+void flash_erase_sector(uint8_t sector, uint32_t program_size)
+{
+    const FlashSector *s = flash_sector_map;
+
+    while(s->use != FLASH_INVALID && s->sector != sector)
+    {
+        ++s;
+    }
+
+    if(flash_mem == NULL || !flash_unlocked || s->use == FLASH_INVALID)
+    {
+        flash_sim_sr |= FLASH_SR_PGSERR;
+        return;
+    }
+
+    memset(flash_mem + (s->start - FLASH_ORIGIN), 0xFF, s->len);
+    stats->erases[sector]++;
+
+    for(size_t i = 0; i < sizeof(erase_times) / sizeof(erase_times[0]); i++)
+    {
+        if(erase_times[i].len == s->len)
+        {
+            stats->busy_us += erase_times[i].erase_us[program_size & 3];
+        }
+    }
+}
+
+/*
+ * flash_program_word() - Program one aligned 32 bit word
+ *
+ * INPUT
+ *     - address: word address
+ *     - data: word to program
+ * OUTPUT
+ *     none
+ */
+void flash_program_word(uint32_t address, uint32_t data)
+{
+    if(flash_sim_ready(address, sizeof(data)))
+    {
+        flash_sim_program(address, (const uint8_t *)&data, sizeof(data));
+    }
+}
+
+/*
+ * flash_program_byte() - Program one byte
+ *
+ * INPUT
+ *     - address: byte address
+ *     - data: byte to program
+ * OUTPUT
+ *     none
+ */
+void flash_program_byte(uint32_t address, uint8_t data)
+{
+    if(flash_sim_ready(address, sizeof(data)))
+    {
+        flash_sim_program(address, &data, sizeof(data));
+    }
+}
+
+/*
+ * flash_program() - Program a buffer a byte at a time
+ *
+ * INPUT
+ *     - address: first byte address
+ *     - data: source data
+ *     - len: number of bytes
+ * OUTPUT
+ *     none
+ */
+void flash_program(uint32_t address, const uint8_t *data, uint32_t len)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        flash_program_byte(address + i, data[i]);
+    }
+}
@@ -20,3657 +20,14 @@
 /* === Includes ============================================================ */
 
 #include "keepkey/board/font.h"
+#include "keepkey/board/text_layout.h"
 
 #include <stddef.h>
 
 /* === Private Variables =================================================== */
 
-/* --- Pin Font ------------------------------------------------------------ */
-
-static const uint8_t image_font_sadface_9x10[9 * 10] =
-{
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff
-};
-static const CharacterImage sadface_9x10 = { image_font_sadface_9x10, 9, 10};
-
-static const uint8_t image_data_pin_font_0x31[48] =
-{
-    0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00
-};
-static const CharacterImage pin_font_0x31 = { image_data_pin_font_0x31, 4, 12};
-
-static const uint8_t image_data_pin_font_0x32[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const CharacterImage pin_font_0x32 = { image_data_pin_font_0x32, 8, 12};
-
-static const uint8_t image_data_pin_font_0x33[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage pin_font_0x33 = { image_data_pin_font_0x33, 8, 12};
-
-static const uint8_t image_data_pin_font_0x34[96] =
-{
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff
-};
-static const CharacterImage pin_font_0x34 = { image_data_pin_font_0x34, 8, 12};
-
-static const uint8_t image_data_pin_font_0x35[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage pin_font_0x35 = { image_data_pin_font_0x35, 8, 12};
-
-static const uint8_t image_data_pin_font_0x36[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage pin_font_0x36 = { image_data_pin_font_0x36, 8, 12};
-
-static const uint8_t image_data_pin_font_0x37[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage pin_font_0x37 = { image_data_pin_font_0x37, 8, 12};
-
-static const uint8_t image_data_pin_font_0x38[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage pin_font_0x38 = { image_data_pin_font_0x38, 8, 12};
-
-static const uint8_t image_data_pin_font_0x39[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage pin_font_0x39 = { image_data_pin_font_0x39, 8, 12};
-
-static const Character pin_font_array[] =
-{
-
-    /* Character: '1' */
-    {0x31, &pin_font_0x31},
-
-    /* Character: '2' */
-    {0x32, &pin_font_0x32},
-
-    /* Character: '3' */
-    {0x33, &pin_font_0x33},
-
-    /* Character: '4' */
-    {0x34, &pin_font_0x34},
-
-    /* Character: '5' */
-    {0x35, &pin_font_0x35},
-
-    /* Character: '6' */
-    {0x36, &pin_font_0x36},
-
-    /* Character: '7' */
-    {0x37, &pin_font_0x37},
-
-    /* Character: '8' */
-    {0x38, &pin_font_0x38},
-
-    /* Character: '9' */
-    {0x39, &pin_font_0x39}
-
-};
-
-static const Font pin_font = { sizeof(pin_font_array)/sizeof(pin_font_array[0]),
-                               14, pin_font_array };
-
-/* --- Title Font ---------------------------------------------------------- */
-
-static const uint8_t image_data_title_font_0x20[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x20 = { image_data_title_font_0x20, 5, 10};
-
-static const uint8_t image_data_title_font_0x21[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x21 = { image_data_title_font_0x21, 3, 10};
-
-static const uint8_t image_data_title_font_0x22[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x22 = { image_data_title_font_0x22, 5, 10};
-
-static const uint8_t image_data_title_font_0x23[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x23 = { image_data_title_font_0x23, 8, 10};
-
-static const uint8_t image_data_title_font_0x24[70] =
-{
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x24 = { image_data_title_font_0x24, 7, 10};
-
-static const uint8_t image_data_title_font_0x25[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x25 = { image_data_title_font_0x25, 9, 10};
-
-static const uint8_t image_data_title_font_0x26[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x26 = { image_data_title_font_0x26, 8, 10};
-
-static const uint8_t image_data_title_font_0x27[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x27 = { image_data_title_font_0x27, 3, 10};
-
-static const uint8_t image_data_title_font_0x28[40] =
-{
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x28 = { image_data_title_font_0x28, 4, 10};
-
-static const uint8_t image_data_title_font_0x29[40] =
-{
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x29 = { image_data_title_font_0x29, 4, 10};
-
-static const uint8_t image_data_title_font_0x2a[70] =
-{
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x2a = { image_data_title_font_0x2a, 7, 10};
-
-static const uint8_t image_data_title_font_0x2b[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x2b = { image_data_title_font_0x2b, 7, 10};
-
-static const uint8_t image_data_title_font_0x2c[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage title_font_0x2c = { image_data_title_font_0x2c, 4, 10};
-
-static const uint8_t image_data_title_font_0x2d[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x2d = { image_data_title_font_0x2d, 7, 10};
-
-static const uint8_t image_data_title_font_0x2e[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x2e = { image_data_title_font_0x2e, 4, 10};
-
-static const uint8_t image_data_title_font_0x2f[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x2f = { image_data_title_font_0x2f, 9, 10};
-
-static const uint8_t image_data_title_font_0x30[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x30 = { image_data_title_font_0x30, 7, 10};
-
-static const uint8_t image_data_title_font_0x31[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x31 = { image_data_title_font_0x31, 4, 10};
-
-static const uint8_t image_data_title_font_0x32[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x32 = { image_data_title_font_0x32, 7, 10};
-
-static const uint8_t image_data_title_font_0x33[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x33 = { image_data_title_font_0x33, 7, 10};
-
-static const uint8_t image_data_title_font_0x34[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x34 = { image_data_title_font_0x34, 7, 10};
-
-static const uint8_t image_data_title_font_0x35[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x35 = { image_data_title_font_0x35, 7, 10};
-
-static const uint8_t image_data_title_font_0x36[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x36 = { image_data_title_font_0x36, 7, 10};
-
-static const uint8_t image_data_title_font_0x37[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x37 = { image_data_title_font_0x37, 7, 10};
-
-static const uint8_t image_data_title_font_0x38[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x38 = { image_data_title_font_0x38, 7, 10};
-
-static const uint8_t image_data_title_font_0x39[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x39 = { image_data_title_font_0x39, 7, 10};
-
-static const uint8_t image_data_title_font_0x3a[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x3a = { image_data_title_font_0x3a, 4, 10};
-
-static const uint8_t image_data_title_font_0x3b[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage title_font_0x3b = { image_data_title_font_0x3b, 4, 10};
-
-static const uint8_t image_data_title_font_0x3c[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x3c = { image_data_title_font_0x3c, 6, 10};
-
-static const uint8_t image_data_title_font_0x3d[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x3d = { image_data_title_font_0x3d, 7, 10};
-
-static const uint8_t image_data_title_font_0x3e[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x3e = { image_data_title_font_0x3e, 6, 10};
-
-static const uint8_t image_data_title_font_0x3f[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x3f = { image_data_title_font_0x3f, 7, 10};
-
-static const uint8_t image_data_title_font_0x40[90] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x40 = { image_data_title_font_0x40, 9, 10};
-
-static const uint8_t image_data_title_font_0x41[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x41 = { image_data_title_font_0x41, 7, 10};
-
-static const uint8_t image_data_title_font_0x42[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x42 = { image_data_title_font_0x42, 7, 10};
-
-static const uint8_t image_data_title_font_0x43[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x43 = { image_data_title_font_0x43, 7, 10};
-
-static const uint8_t image_data_title_font_0x44[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x44 = { image_data_title_font_0x44, 7, 10};
-
-static const uint8_t image_data_title_font_0x45[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x45 = { image_data_title_font_0x45, 7, 10};
-
-static const uint8_t image_data_title_font_0x46[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x46 = { image_data_title_font_0x46, 7, 10};
-
-static const uint8_t image_data_title_font_0x47[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x47 = { image_data_title_font_0x47, 7, 10};
-
-static const uint8_t image_data_title_font_0x48[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x48 = { image_data_title_font_0x48, 7, 10};
-
-static const uint8_t image_data_title_font_0x49[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x49 = { image_data_title_font_0x49, 5, 10};
-
-static const uint8_t image_data_title_font_0x4a[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x4a = { image_data_title_font_0x4a, 7, 10};
-
-static const uint8_t image_data_title_font_0x4b[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x4b = { image_data_title_font_0x4b, 7, 10};
-
-static const uint8_t image_data_title_font_0x4c[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x4c = { image_data_title_font_0x4c, 7, 10};
-
-static const uint8_t image_data_title_font_0x4d[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x4d = { image_data_title_font_0x4d, 9, 10};
-
-static const uint8_t image_data_title_font_0x4e[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x4e = { image_data_title_font_0x4e, 7, 10};
-
-static const uint8_t image_data_title_font_0x4f[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x4f = { image_data_title_font_0x4f, 7, 10};
-
-static const uint8_t image_data_title_font_0x50[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x50 = { image_data_title_font_0x50, 7, 10};
-
-static const uint8_t image_data_title_font_0x51[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x51 = { image_data_title_font_0x51, 7, 10};
-
-static const uint8_t image_data_title_font_0x52[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x52 = { image_data_title_font_0x52, 7, 10};
-
-static const uint8_t image_data_title_font_0x53[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x53 = { image_data_title_font_0x53, 7, 10};
-
-static const uint8_t image_data_title_font_0x54[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x54 = { image_data_title_font_0x54, 7, 10};
-
-static const uint8_t image_data_title_font_0x55[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x55 = { image_data_title_font_0x55, 7, 10};
-
-static const uint8_t image_data_title_font_0x56[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x56 = { image_data_title_font_0x56, 7, 10};
-
-static const uint8_t image_data_title_font_0x57[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x57 = { image_data_title_font_0x57, 9, 10};
-
-static const uint8_t image_data_title_font_0x58[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x58 = { image_data_title_font_0x58, 7, 10};
-
-static const uint8_t image_data_title_font_0x59[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x59 = { image_data_title_font_0x59, 7, 10};
-
-static const uint8_t image_data_title_font_0x5a[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x5a = { image_data_title_font_0x5a, 7, 10};
-
-static const uint8_t image_data_title_font_0x5b[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x5b = { image_data_title_font_0x5b, 5, 10};
-
-static const uint8_t image_data_title_font_0x5c[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x5c = { image_data_title_font_0x5c, 9, 10};
-
-static const uint8_t image_data_title_font_0x5d[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x5d = { image_data_title_font_0x5d, 5, 10};
-
-static const uint8_t image_data_title_font_0x5e[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x5e = { image_data_title_font_0x5e, 5, 10};
-
-static const uint8_t image_data_title_font_0x5f[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x5f = { image_data_title_font_0x5f, 7, 10};
-
-static const uint8_t image_data_title_font_0x60[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x60 = { image_data_title_font_0x60, 4, 10};
-
-static const uint8_t image_data_title_font_0x61[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x61 = { image_data_title_font_0x61, 7, 10};
-
-static const uint8_t image_data_title_font_0x62[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x62 = { image_data_title_font_0x62, 7, 10};
-
-static const uint8_t image_data_title_font_0x63[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x63 = { image_data_title_font_0x63, 7, 10};
-
-static const uint8_t image_data_title_font_0x64[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x64 = { image_data_title_font_0x64, 7, 10};
-
-static const uint8_t image_data_title_font_0x65[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x65 = { image_data_title_font_0x65, 7, 10};
-
-static const uint8_t image_data_title_font_0x66[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x66 = { image_data_title_font_0x66, 6, 10};
-
-static const uint8_t image_data_title_font_0x67[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage title_font_0x67 = { image_data_title_font_0x67, 7, 10};
-
-static const uint8_t image_data_title_font_0x68[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x68 = { image_data_title_font_0x68, 7, 10};
-
-static const uint8_t image_data_title_font_0x69[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x69 = { image_data_title_font_0x69, 3, 10};
-
-static const uint8_t image_data_title_font_0x6a[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage title_font_0x6a = { image_data_title_font_0x6a, 4, 10};
-
-static const uint8_t image_data_title_font_0x6b[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x6b = { image_data_title_font_0x6b, 6, 10};
-
-static const uint8_t image_data_title_font_0x6c[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x6c = { image_data_title_font_0x6c, 3, 10};
-
-static const uint8_t image_data_title_font_0x6d[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x6d = { image_data_title_font_0x6d, 9, 10};
-
-static const uint8_t image_data_title_font_0x6e[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x6e = { image_data_title_font_0x6e, 7, 10};
-
-static const uint8_t image_data_title_font_0x6f[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x6f = { image_data_title_font_0x6f, 7, 10};
-
-static const uint8_t image_data_title_font_0x70[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x70 = { image_data_title_font_0x70, 7, 10};
-
-static const uint8_t image_data_title_font_0x71[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff
-};
-static const CharacterImage title_font_0x71 = { image_data_title_font_0x71, 7, 10};
-
-static const uint8_t image_data_title_font_0x72[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x72 = { image_data_title_font_0x72, 6, 10};
-
-static const uint8_t image_data_title_font_0x73[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x73 = { image_data_title_font_0x73, 7, 10};
-
-static const uint8_t image_data_title_font_0x74[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x74 = { image_data_title_font_0x74, 6, 10};
-
-static const uint8_t image_data_title_font_0x75[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x75 = { image_data_title_font_0x75, 7, 10};
-
-static const uint8_t image_data_title_font_0x76[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x76 = { image_data_title_font_0x76, 7, 10};
-
-static const uint8_t image_data_title_font_0x77[90] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x77 = { image_data_title_font_0x77, 9, 10};
-
-static const uint8_t image_data_title_font_0x78[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x78 = { image_data_title_font_0x78, 7, 10};
-
-static const uint8_t image_data_title_font_0x79[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage title_font_0x79 = { image_data_title_font_0x79, 7, 10};
-
-static const uint8_t image_data_title_font_0x7a[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x7a = { image_data_title_font_0x7a, 7, 10};
-
-static const uint8_t image_data_title_font_0x7b[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x7b = { image_data_title_font_0x7b, 6, 10};
-
-static const uint8_t image_data_title_font_0x7c[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x7c = { image_data_title_font_0x7c, 3, 10};
-
-static const uint8_t image_data_title_font_0x7d[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x7d = { image_data_title_font_0x7d, 6, 10};
-
-static const uint8_t image_data_title_font_0x7e[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage title_font_0x7e = { image_data_title_font_0x7e, 7, 10};
-
-
-static const Character title_font_array[] =
-{
-
-    /* Character: ' ' */
-    {0x20, &title_font_0x20},
-
-    /* Character: '!' */
-    {0x21, &title_font_0x21},
-
-    /* Character: '"' */
-    {0x22, &title_font_0x22},
-
-    /* Character: '#' */
-    {0x23, &title_font_0x23},
-
-    /* Character: '$' */
-    {0x24, &title_font_0x24},
-
-    /* Character: '%' */
-    {0x25, &title_font_0x25},
-
-    /* Character: '&' */
-    {0x26, &title_font_0x26},
-
-    /* Character: ''' */
-    {0x27, &title_font_0x27},
-
-    /* Character: '(' */
-    {0x28, &title_font_0x28},
-
-    /* Character: ')' */
-    {0x29, &title_font_0x29},
-
-    /* Character: '*' */
-    {0x2a, &title_font_0x2a},
-
-    /* Character: '+' */
-    {0x2b, &title_font_0x2b},
-
-    /* Character: ',' */
-    {0x2c, &title_font_0x2c},
-
-    /* Character: '-' */
-    {0x2d, &title_font_0x2d},
-
-    /* Character: '.' */
-    {0x2e, &title_font_0x2e},
-
-    /* Character: '/' */
-    {0x2f, &title_font_0x2f},
-
-    /* Character: '0' */
-    {0x30, &title_font_0x30},
-
-    /* Character: '1' */
-    {0x31, &title_font_0x31},
-
-    /* Character: '2' */
-    {0x32, &title_font_0x32},
-
-    /* Character: '3' */
-    {0x33, &title_font_0x33},
-
-    /* Character: '4' */
-    {0x34, &title_font_0x34},
-
-    /* Character: '5' */
-    {0x35, &title_font_0x35},
-
-    /* Character: '6' */
-    {0x36, &title_font_0x36},
-
-    /* Character: '7' */
-    {0x37, &title_font_0x37},
-
-    /* Character: '8' */
-    {0x38, &title_font_0x38},
-
-    /* Character: '9' */
-    {0x39, &title_font_0x39},
-
-    /* Character: ':' */
-    {0x3a, &title_font_0x3a},
-
-    /* Character: ';' */
-    {0x3b, &title_font_0x3b},
-
-    /* Character: '<' */
-    {0x3c, &title_font_0x3c},
-
-    /* Character: '=' */
-    {0x3d, &title_font_0x3d},
-
-    /* Character: '>' */
-    {0x3e, &title_font_0x3e},
-
-    /* Character: '?' */
-    {0x3f, &title_font_0x3f},
-
-    /* Character: '\x0040' */
-    {0x40, &title_font_0x40},
-
-    /* Character: 'A' */
-    {0x41, &title_font_0x41},
-
-    /* Character: 'B' */
-    {0x42, &title_font_0x42},
-
-    /* Character: 'C' */
-    {0x43, &title_font_0x43},
-
-    /* Character: 'D' */
-    {0x44, &title_font_0x44},
-
-    /* Character: 'E' */
-    {0x45, &title_font_0x45},
-
-    /* Character: 'F' */
-    {0x46, &title_font_0x46},
-
-    /* Character: 'G' */
-    {0x47, &title_font_0x47},
-
-    /* Character: 'H' */
-    {0x48, &title_font_0x48},
-
-    /* Character: 'I' */
-    {0x49, &title_font_0x49},
-
-    /* Character: 'J' */
-    {0x4a, &title_font_0x4a},
-
-    /* Character: 'K' */
-    {0x4b, &title_font_0x4b},
-
-    /* Character: 'L' */
-    {0x4c, &title_font_0x4c},
-
-    /* Character: 'M' */
-    {0x4d, &title_font_0x4d},
-
-    /* Character: 'N' */
-    {0x4e, &title_font_0x4e},
-
-    /* Character: 'O' */
-    {0x4f, &title_font_0x4f},
-
-    /* Character: 'P' */
-    {0x50, &title_font_0x50},
-
-    /* Character: 'Q' */
-    {0x51, &title_font_0x51},
-
-    /* Character: 'R' */
-    {0x52, &title_font_0x52},
-
-    /* Character: 'S' */
-    {0x53, &title_font_0x53},
-
-    /* Character: 'T' */
-    {0x54, &title_font_0x54},
-
-    /* Character: 'U' */
-    {0x55, &title_font_0x55},
-
-    /* Character: 'V' */
-    {0x56, &title_font_0x56},
-
-    /* Character: 'W' */
-    {0x57, &title_font_0x57},
-
-    /* Character: 'X' */
-    {0x58, &title_font_0x58},
-
-    /* Character: 'Y' */
-    {0x59, &title_font_0x59},
-
-    /* Character: 'Z' */
-    {0x5a, &title_font_0x5a},
-
-    /* Character: '[' */
-    {0x5b, &title_font_0x5b},
-
-    /* Character: '\' */
-    {0x5c, &title_font_0x5c},
-
-    /* Character: ']' */
-    {0x5d, &title_font_0x5d},
-
-    /* Character: '^' */
-    {0x5e, &title_font_0x5e},
-
-    /* Character: '_' */
-    {0x5f, &title_font_0x5f},
-
-    /* Character: '`' */
-    {0x60, &title_font_0x60},
-
-    /* Character: 'a' */
-    {0x61, &title_font_0x61},
-
-    /* Character: 'b' */
-    {0x62, &title_font_0x62},
-
-    /* Character: 'c' */
-    {0x63, &title_font_0x63},
-
-    /* Character: 'd' */
-    {0x64, &title_font_0x64},
-
-    /* Character: 'e' */
-    {0x65, &title_font_0x65},
-
-    /* Character: 'f' */
-    {0x66, &title_font_0x66},
-
-    /* Character: 'g' */
-    {0x67, &title_font_0x67},
-
-    /* Character: 'h' */
-    {0x68, &title_font_0x68},
-
-    /* Character: 'i' */
-    {0x69, &title_font_0x69},
-
-    /* Character: 'j' */
-    {0x6a, &title_font_0x6a},
-
-    /* Character: 'k' */
-    {0x6b, &title_font_0x6b},
-
-    /* Character: 'l' */
-    {0x6c, &title_font_0x6c},
-
-    /* Character: 'm' */
-    {0x6d, &title_font_0x6d},
-
-    /* Character: 'n' */
-    {0x6e, &title_font_0x6e},
-
-    /* Character: 'o' */
-    {0x6f, &title_font_0x6f},
-
-    /* Character: 'p' */
-    {0x70, &title_font_0x70},
-
-    /* Character: 'q' */
-    {0x71, &title_font_0x71},
-
-    /* Character: 'r' */
-    {0x72, &title_font_0x72},
-
-    /* Character: 's' */
-    {0x73, &title_font_0x73},
-
-    /* Character: 't' */
-    {0x74, &title_font_0x74},
-
-    /* Character: 'u' */
-    {0x75, &title_font_0x75},
-
-    /* Character: 'v' */
-    {0x76, &title_font_0x76},
-
-    /* Character: 'w' */
-    {0x77, &title_font_0x77},
-
-    /* Character: 'x' */
-    {0x78, &title_font_0x78},
-
-    /* Character: 'y' */
-    {0x79, &title_font_0x79},
-
-    /* Character: 'z' */
-    {0x7a, &title_font_0x7a},
-
-    /* Character: '{' */
-    {0x7b, &title_font_0x7b},
-
-    /* Character: '|' */
-    {0x7c, &title_font_0x7c},
-
-    /* Character: '}' */
-    {0x7d, &title_font_0x7d},
-
-    /* Character: '~' */
-    {0x7e, &title_font_0x7e}
-
-};
-
-static const Font title_font = { sizeof(title_font_array)/sizeof(title_font_array[0]),
-                                 10, title_font_array };
-
-/* --- Body Font ----------------------------------------------------------- */
-
-static const uint8_t image_data_body_font_0x20[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x20 = { image_data_body_font_0x20, 4, 10};
-
-static const uint8_t image_data_body_font_0x21[20] =
-{
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const CharacterImage body_font_0x21 = { image_data_body_font_0x21, 2, 10};
-
-static const uint8_t image_data_body_font_0x22[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x22 = { image_data_body_font_0x22, 4, 10};
-
-static const uint8_t image_data_body_font_0x23[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x23 = { image_data_body_font_0x23, 7, 10};
-
-static const uint8_t image_data_body_font_0x24[60] =
-{
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x24 = { image_data_body_font_0x24, 6, 10};
-
-static const uint8_t image_data_body_font_0x25[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x25 = { image_data_body_font_0x25, 8, 10};
-
-static const uint8_t image_data_body_font_0x26[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x26 = { image_data_body_font_0x26, 7, 10};
-
-static const uint8_t image_data_body_font_0x27[20] =
-{
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const CharacterImage body_font_0x27 = { image_data_body_font_0x27, 2, 10};
-
-static const uint8_t image_data_body_font_0x28[30] =
-{
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x28 = { image_data_body_font_0x28, 3, 10};
-
-static const uint8_t image_data_body_font_0x29[30] =
-{
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x29 = { image_data_body_font_0x29, 3, 10};
-
-static const uint8_t image_data_body_font_0x2a[60] =
-{
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x2a = { image_data_body_font_0x2a, 6, 10};
-
-static const uint8_t image_data_body_font_0x2b[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x2b = { image_data_body_font_0x2b, 6, 10};
-
-static const uint8_t image_data_body_font_0x2c[30] =
-{
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
-};
-static const CharacterImage body_font_0x2c = { image_data_body_font_0x2c, 3, 10};
-
-static const uint8_t image_data_body_font_0x2d[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x2d = { image_data_body_font_0x2d, 6, 10};
-
-static const uint8_t image_data_body_font_0x2e[30] =
-{
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x2e = { image_data_body_font_0x2e, 3, 10};
-
-static const uint8_t image_data_body_font_0x2f[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x2f = { image_data_body_font_0x2f, 8, 10};
-
-static const uint8_t image_data_body_font_0x30[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x30 = { image_data_body_font_0x30, 6, 10};
-
-static const uint8_t image_data_body_font_0x31[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x31 = { image_data_body_font_0x31, 3, 10};
-
-static const uint8_t image_data_body_font_0x32[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x32 = { image_data_body_font_0x32, 6, 10};
-
-static const uint8_t image_data_body_font_0x33[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x33 = { image_data_body_font_0x33, 6, 10};
-
-static const uint8_t image_data_body_font_0x34[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x34 = { image_data_body_font_0x34, 6, 10};
-
-static const uint8_t image_data_body_font_0x35[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x35 = { image_data_body_font_0x35, 6, 10};
-
-static const uint8_t image_data_body_font_0x36[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x36 = { image_data_body_font_0x36, 6, 10};
-
-static const uint8_t image_data_body_font_0x37[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x37 = { image_data_body_font_0x37, 6, 10};
-
-static const uint8_t image_data_body_font_0x38[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x38 = { image_data_body_font_0x38, 6, 10};
-
-static const uint8_t image_data_body_font_0x39[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x39 = { image_data_body_font_0x39, 6, 10};
-
-static const uint8_t image_data_body_font_0x3a[30] =
-{
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x3a = { image_data_body_font_0x3a, 3, 10};
-
-static const uint8_t image_data_body_font_0x3b[30] =
-{
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
-};
-static const CharacterImage body_font_0x3b = { image_data_body_font_0x3b, 3, 10};
-
-static const uint8_t image_data_body_font_0x3c[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x3c = { image_data_body_font_0x3c, 5, 10};
-
-static const uint8_t image_data_body_font_0x3d[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x3d = { image_data_body_font_0x3d, 6, 10};
-
-static const uint8_t image_data_body_font_0x3e[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x3e = { image_data_body_font_0x3e, 5, 10};
-
-static const uint8_t image_data_body_font_0x3f[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x3f = { image_data_body_font_0x3f, 6, 10};
-
-static const uint8_t image_data_body_font_0x40[80] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x40 = { image_data_body_font_0x40, 8, 10};
-
-static const uint8_t image_data_body_font_0x41[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x41 = { image_data_body_font_0x41, 6, 10};
-
-static const uint8_t image_data_body_font_0x42[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x42 = { image_data_body_font_0x42, 6, 10};
-
-static const uint8_t image_data_body_font_0x43[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x43 = { image_data_body_font_0x43, 6, 10};
-
-static const uint8_t image_data_body_font_0x44[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x44 = { image_data_body_font_0x44, 6, 10};
-
-static const uint8_t image_data_body_font_0x45[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x45 = { image_data_body_font_0x45, 6, 10};
-
-static const uint8_t image_data_body_font_0x46[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x46 = { image_data_body_font_0x46, 6, 10};
-
-static const uint8_t image_data_body_font_0x47[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x47 = { image_data_body_font_0x47, 6, 10};
-
-static const uint8_t image_data_body_font_0x48[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x48 = { image_data_body_font_0x48, 6, 10};
-
-static const uint8_t image_data_body_font_0x49[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x49 = { image_data_body_font_0x49, 4, 10};
-
-static const uint8_t image_data_body_font_0x4a[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x4a = { image_data_body_font_0x4a, 6, 10};
-
-static const uint8_t image_data_body_font_0x4b[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x4b = { image_data_body_font_0x4b, 6, 10};
-
-static const uint8_t image_data_body_font_0x4c[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x4c = { image_data_body_font_0x4c, 6, 10};
-
-static const uint8_t image_data_body_font_0x4d[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x4d = { image_data_body_font_0x4d, 8, 10};
-
-static const uint8_t image_data_body_font_0x4e[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x4e = { image_data_body_font_0x4e, 6, 10};
-
-static const uint8_t image_data_body_font_0x4f[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x4f = { image_data_body_font_0x4f, 6, 10};
-
-static const uint8_t image_data_body_font_0x50[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x50 = { image_data_body_font_0x50, 6, 10};
-
-static const uint8_t image_data_body_font_0x51[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x51 = { image_data_body_font_0x51, 6, 10};
-
-static const uint8_t image_data_body_font_0x52[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x52 = { image_data_body_font_0x52, 6, 10};
-
-static const uint8_t image_data_body_font_0x53[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x53 = { image_data_body_font_0x53, 6, 10};
-
-static const uint8_t image_data_body_font_0x54[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x54 = { image_data_body_font_0x54, 6, 10};
-
-static const uint8_t image_data_body_font_0x55[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x55 = { image_data_body_font_0x55, 6, 10};
-
-static const uint8_t image_data_body_font_0x56[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x56 = { image_data_body_font_0x56, 6, 10};
-
-static const uint8_t image_data_body_font_0x57[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x57 = { image_data_body_font_0x57, 8, 10};
-
-static const uint8_t image_data_body_font_0x58[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x58 = { image_data_body_font_0x58, 6, 10};
-
-static const uint8_t image_data_body_font_0x59[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x59 = { image_data_body_font_0x59, 6, 10};
-
-static const uint8_t image_data_body_font_0x5a[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x5a = { image_data_body_font_0x5a, 6, 10};
-
-static const uint8_t image_data_body_font_0x5b[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x5b = { image_data_body_font_0x5b, 4, 10};
-
-static const uint8_t image_data_body_font_0x5c[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x5c = { image_data_body_font_0x5c, 8, 10};
-
-static const uint8_t image_data_body_font_0x5d[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x5d = { image_data_body_font_0x5d, 4, 10};
-
-static const uint8_t image_data_body_font_0x5e[40] =
-{
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x5e = { image_data_body_font_0x5e, 4, 10};
-
-static const uint8_t image_data_body_font_0x5f[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x5f = { image_data_body_font_0x5f, 6, 10};
-
-static const uint8_t image_data_body_font_0x60[30] =
-{
-    0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x60 = { image_data_body_font_0x60, 3, 10};
-
-static const uint8_t image_data_body_font_0x61[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x61 = { image_data_body_font_0x61, 6, 10};
-
-static const uint8_t image_data_body_font_0x62[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x62 = { image_data_body_font_0x62, 6, 10};
-
-static const uint8_t image_data_body_font_0x63[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x63 = { image_data_body_font_0x63, 6, 10};
-
-static const uint8_t image_data_body_font_0x64[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x64 = { image_data_body_font_0x64, 6, 10};
-
-static const uint8_t image_data_body_font_0x65[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x65 = { image_data_body_font_0x65, 6, 10};
-
-static const uint8_t image_data_body_font_0x66[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x66 = { image_data_body_font_0x66, 5, 10};
-
-static const uint8_t image_data_body_font_0x67[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage body_font_0x67 = { image_data_body_font_0x67, 6, 10};
-
-static const uint8_t image_data_body_font_0x68[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x68 = { image_data_body_font_0x68, 6, 10};
-
-static const uint8_t image_data_body_font_0x69[20] =
-{
-    0xff, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const CharacterImage body_font_0x69 = { image_data_body_font_0x69, 2, 10};
-
-static const uint8_t image_data_body_font_0x6a[30] =
-{
-    0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
-};
-static const CharacterImage body_font_0x6a = { image_data_body_font_0x6a, 3, 10};
-
-static const uint8_t image_data_body_font_0x6b[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x6b = { image_data_body_font_0x6b, 5, 10};
-
-static const uint8_t image_data_body_font_0x6c[20] =
-{
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const CharacterImage body_font_0x6c = { image_data_body_font_0x6c, 2, 10};
-
-static const uint8_t image_data_body_font_0x6d[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x6d = { image_data_body_font_0x6d, 8, 10};
-
-static const uint8_t image_data_body_font_0x6e[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x6e = { image_data_body_font_0x6e, 6, 10};
-
-static const uint8_t image_data_body_font_0x6f[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x6f = { image_data_body_font_0x6f, 6, 10};
-
-static const uint8_t image_data_body_font_0x70[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x70 = { image_data_body_font_0x70, 6, 10};
-
-static const uint8_t image_data_body_font_0x71[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff
-};
-static const CharacterImage body_font_0x71 = { image_data_body_font_0x71, 6, 10};
-
-static const uint8_t image_data_body_font_0x72[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x72 = { image_data_body_font_0x72, 5, 10};
-
-static const uint8_t image_data_body_font_0x73[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x73 = { image_data_body_font_0x73, 6, 10};
-
-static const uint8_t image_data_body_font_0x74[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x74 = { image_data_body_font_0x74, 5, 10};
-
-static const uint8_t image_data_body_font_0x75[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x75 = { image_data_body_font_0x75, 6, 10};
-
-static const uint8_t image_data_body_font_0x76[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x76 = { image_data_body_font_0x76, 6, 10};
-
-static const uint8_t image_data_body_font_0x77[80] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x77 = { image_data_body_font_0x77, 8, 10};
-
-static const uint8_t image_data_body_font_0x78[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x78 = { image_data_body_font_0x78, 6, 10};
-
-static const uint8_t image_data_body_font_0x79[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff
-};
-static const CharacterImage body_font_0x79 = { image_data_body_font_0x79, 6, 10};
-
-static const uint8_t image_data_body_font_0x7a[60] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x7a = { image_data_body_font_0x7a, 6, 10};
-
-static const uint8_t image_data_body_font_0x7b[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x7b = { image_data_body_font_0x7b, 5, 10};
-
-static const uint8_t image_data_body_font_0x7c[20] =
-{
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const CharacterImage body_font_0x7c = { image_data_body_font_0x7c, 2, 10};
-
-static const uint8_t image_data_body_font_0x7d[50] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x7d = { image_data_body_font_0x7d, 5, 10};
-
-static const uint8_t image_data_body_font_0x7e[70] =
-{
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-static const CharacterImage body_font_0x7e = { image_data_body_font_0x7e, 7, 10};
-
-
-static const Character body_font_array[] =
-{
-
-    /* Character: ' ' */
-    {0x20, &body_font_0x20},
-
-    /* Character: '!' */
-    {0x21, &body_font_0x21},
-
-    /* Character: '"' */
-    {0x22, &body_font_0x22},
-
-    /* Character: '#' */
-    {0x23, &body_font_0x23},
-
-    /* Character: '$' */
-    {0x24, &body_font_0x24},
-
-    /* Character: '%' */
-    {0x25, &body_font_0x25},
-
-    /* Character: '&' */
-    {0x26, &body_font_0x26},
-
-    /* Character: ''' */
-    {0x27, &body_font_0x27},
-
-    /* Character: '(' */
-    {0x28, &body_font_0x28},
-
-    /* Character: ')' */
-    {0x29, &body_font_0x29},
-
-    /* Character: '*' */
-    {0x2a, &body_font_0x2a},
-
-    /* Character: '+' */
-    {0x2b, &body_font_0x2b},
-
-    /* Character: ',' */
-    {0x2c, &body_font_0x2c},
-
-    /* Character: '-' */
-    {0x2d, &body_font_0x2d},
-
-    /* Character: '.' */
-    {0x2e, &body_font_0x2e},
-
-    /* Character: '/' */
-    {0x2f, &body_font_0x2f},
-
-    /* Character: '0' */
-    {0x30, &body_font_0x30},
-
-    /* Character: '1' */
-    {0x31, &body_font_0x31},
-
-    /* Character: '2' */
-    {0x32, &body_font_0x32},
-
-    /* Character: '3' */
-    {0x33, &body_font_0x33},
-
-    /* Character: '4' */
-    {0x34, &body_font_0x34},
-
-    /* Character: '5' */
-    {0x35, &body_font_0x35},
-
-    /* Character: '6' */
-    {0x36, &body_font_0x36},
-
-    /* Character: '7' */
-    {0x37, &body_font_0x37},
-
-    /* Character: '8' */
-    {0x38, &body_font_0x38},
-
-    /* Character: '9' */
-    {0x39, &body_font_0x39},
-
-    /* Character: ':' */
-    {0x3a, &body_font_0x3a},
-
-    /* Character: ';' */
-    {0x3b, &body_font_0x3b},
-
-    /* Character: '<' */
-    {0x3c, &body_font_0x3c},
-
-    /* Character: '=' */
-    {0x3d, &body_font_0x3d},
-
-    /* Character: '>' */
-    {0x3e, &body_font_0x3e},
-
-    /* Character: '?' */
-    {0x3f, &body_font_0x3f},
-
-    /* Character: '\x0040' */
-    {0x40, &body_font_0x40},
-
-    /* Character: 'A' */
-    {0x41, &body_font_0x41},
-
-    /* Character: 'B' */
-    {0x42, &body_font_0x42},
-
-    /* Character: 'C' */
-    {0x43, &body_font_0x43},
-
-    /* Character: 'D' */
-    {0x44, &body_font_0x44},
-
-    /* Character: 'E' */
-    {0x45, &body_font_0x45},
-
-    /* Character: 'F' */
-    {0x46, &body_font_0x46},
-
-    /* Character: 'G' */
-    {0x47, &body_font_0x47},
-
-    /* Character: 'H' */
-    {0x48, &body_font_0x48},
-
-    /* Character: 'I' */
-    {0x49, &body_font_0x49},
-
-    /* Character: 'J' */
-    {0x4a, &body_font_0x4a},
-
-    /* Character: 'K' */
-    {0x4b, &body_font_0x4b},
-
-    /* Character: 'L' */
-    {0x4c, &body_font_0x4c},
-
-    /* Character: 'M' */
-    {0x4d, &body_font_0x4d},
-
-    /* Character: 'N' */
-    {0x4e, &body_font_0x4e},
-
-    /* Character: 'O' */
-    {0x4f, &body_font_0x4f},
-
-    /* Character: 'P' */
-    {0x50, &body_font_0x50},
-
-    /* Character: 'Q' */
-    {0x51, &body_font_0x51},
-
-    /* Character: 'R' */
-    {0x52, &body_font_0x52},
-
-    /* Character: 'S' */
-    {0x53, &body_font_0x53},
-
-    /* Character: 'T' */
-    {0x54, &body_font_0x54},
-
-    /* Character: 'U' */
-    {0x55, &body_font_0x55},
-
-    /* Character: 'V' */
-    {0x56, &body_font_0x56},
-
-    /* Character: 'W' */
-    {0x57, &body_font_0x57},
-
-    /* Character: 'X' */
-    {0x58, &body_font_0x58},
-
-    /* Character: 'Y' */
-    {0x59, &body_font_0x59},
-
-    /* Character: 'Z' */
-    {0x5a, &body_font_0x5a},
-
-    /* Character: '[' */
-    {0x5b, &body_font_0x5b},
-
-    /* Character: '\' */
-    {0x5c, &body_font_0x5c},
-
-    /* Character: ']' */
-    {0x5d, &body_font_0x5d},
-
-    /* Character: '^' */
-    {0x5e, &body_font_0x5e},
-
-    /* Character: '_' */
-    {0x5f, &body_font_0x5f},
-
-    /* Character: '`' */
-    {0x60, &body_font_0x60},
-
-    /* Character: 'a' */
-    {0x61, &body_font_0x61},
-
-    /* Character: 'b' */
-    {0x62, &body_font_0x62},
-
-    /* Character: 'c' */
-    {0x63, &body_font_0x63},
-
-    /* Character: 'd' */
-    {0x64, &body_font_0x64},
-
-    /* Character: 'e' */
-    {0x65, &body_font_0x65},
-
-    /* Character: 'f' */
-    {0x66, &body_font_0x66},
-
-    /* Character: 'g' */
-    {0x67, &body_font_0x67},
-
-    /* Character: 'h' */
-    {0x68, &body_font_0x68},
-
-    /* Character: 'i' */
-    {0x69, &body_font_0x69},
-
-    /* Character: 'j' */
-    {0x6a, &body_font_0x6a},
-
-    /* Character: 'k' */
-    {0x6b, &body_font_0x6b},
-
-    /* Character: 'l' */
-    {0x6c, &body_font_0x6c},
-
-    /* Character: 'm' */
-    {0x6d, &body_font_0x6d},
-
-    /* Character: 'n' */
-    {0x6e, &body_font_0x6e},
-
-    /* Character: 'o' */
-    {0x6f, &body_font_0x6f},
-
-    /* Character: 'p' */
-    {0x70, &body_font_0x70},
-
-    /* Character: 'q' */
-    {0x71, &body_font_0x71},
-
-    /* Character: 'r' */
-    {0x72, &body_font_0x72},
-
-    /* Character: 's' */
-    {0x73, &body_font_0x73},
-
-    /* Character: 't' */
-    {0x74, &body_font_0x74},
-
-    /* Character: 'u' */
-    {0x75, &body_font_0x75},
-
-    /* Character: 'v' */
-    {0x76, &body_font_0x76},
-
-    /* Character: 'w' */
-    {0x77, &body_font_0x77},
-
-    /* Character: 'x' */
-    {0x78, &body_font_0x78},
-
-    /* Character: 'y' */
-    {0x79, &body_font_0x79},
-
-    /* Character: 'z' */
-    {0x7a, &body_font_0x7a},
-
-    /* Character: '{' */
-    {0x7b, &body_font_0x7b},
-
-    /* Character: '|' */
-    {0x7c, &body_font_0x7c},
-
-    /* Character: '}' */
-    {0x7d, &body_font_0x7d},
-
-    /* Character: '~' (we use this one for checkmark) */
-    {0x7e, &body_font_0x7e}
-
-};
-
-static const Font body_font = { sizeof(body_font_array)/sizeof(body_font_array[0]),
-                                10, body_font_array };
+/* Glyph tables, packed from fonts.txt at build time */
+#include "font_data.inc"
 
 /* === Functions =========================================================== */
 
@@ -3729,15 +86,14 @@ const Font *get_body_font(void)
  */
 const CharacterImage *font_get_char(const Font *font, char c)
 {
-    for (int i = 0; i < font->length; i++)
+    int index = (int)(unsigned char)c - font->first;
+
+    if(index >= 0 && index < font->length)
     {
-        if(font->characters[ i ].code == c)
-        {
-            return font->characters[ i ].image;
-        }
+        return &font->images[ index ];
     }
 
-    return &sadface_9x10;
+    return &sadface;
 }
 
 /*
@@ -3801,51 +157,5 @@ uint32_t calc_str_width(const Font *font, const char *str)
  */
 uint32_t calc_str_line(const Font *font, const char *str, uint16_t line_width)
 {
-    uint8_t line_count = 1;
-    uint16_t x_offset = 0;
-
-    while(*str)
-    {
-        uint8_t character_width = font_get_char(font, str[0])->width;
-        uint16_t word_width = character_width;
-        char *next_character = (char *)str + 1;
-
-        /* Allow line breaks */
-        if(*str == '\n')
-        {
-            line_count++;
-            x_offset = 0;
-            str++;
-            continue;
-        }
-
-        /* Calculate next work width */
-        if(*str == ' ')
-        {
-            while(*next_character && *next_character != ' ' && *next_character != '\n')
-            {
-                word_width += font_get_char(font, *next_character)->width;
-                next_character++;
-            }
-        }
-
-        /* New line? */
-        if(x_offset + word_width > line_width)
-        {
-            line_count++;
-            x_offset = 0;
-        }
-
-        /* Remove leading spaces */
-        if(x_offset == 0 && *str == ' ')
-        {
-            str++;
-            continue;
-        }
-
-        x_offset += character_width;
-        str++;
-    }
-
-    return line_count;
+    return text_layout(font, str, line_width)->count;
 }
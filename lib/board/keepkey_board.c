@@ -82,7 +82,7 @@ void nmi_handler(void)
 #endif
 
 /*
- * board_reset() - Request board reset
+ * board_reset() - Request board reset once queued USB packets are sent
  *
  * INPUT
  *     none
@@ -92,6 +92,7 @@ void nmi_handler(void)
 void board_reset(void)
 {
 #ifndef EMULATOR
+    usb_flush();
     scb_reset_system();
 #endif
 }
@@ -129,10 +130,20 @@ uint32_t calc_crc32(uint32_t *data, int word_len)
 {
     uint32_t crc32 = 0;
 
-    // TODO: implement crc32 on the emulator side of things
 #ifndef EMULATOR
     crc_reset();
     crc32 = crc_calculate_block(data, word_len);
+#else
+    /* Same as the CRC unit: poly 0x04C11DB7, whole words MSB first */
+    crc32 = 0xFFFFFFFF;
+    for(int i = 0; i < word_len; i++)
+    {
+        crc32 ^= data[i];
+        for(int bit = 0; bit < 32; bit++)
+        {
+            crc32 = (crc32 & 0x80000000) ? (crc32 << 1) ^ 0x04C11DB7 : crc32 << 1;
+        }
+    }
 #endif
 
     return(crc32);
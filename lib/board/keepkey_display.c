@@ -26,6 +26,8 @@
 #include "keepkey/board/pin.h"
 #include "keepkey/board/timer.h"
 
+#include <assert.h>
+
 #pragma GCC push_options
 #pragma GCC optimize("-O3")
 
@@ -40,65 +42,212 @@ static const Pin nRESET_PIN    = { GPIOB, GPIO5 };
 static const Pin BACKLIGHT_PWR_PIN = { GPIOB, GPIO0 };
 #endif
 
-static uint8_t canvas_buffer[ KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH ];
+static uint8_t canvas_buffer[ KEEPKEY_DISPLAY_HEIGHT * CANVAS_STRIDE(KEEPKEY_DISPLAY_WIDTH) ];
 static Canvas canvas;
 
 /*
- * display_write_reg() - Write data to display register
+ * SSD1322 8080 interface write timing minimums, in ns, counted in cycles
+ * of the 120 MHz CPU clock.
+ */
+#define DISPLAY_CPU_MHZ             120
+#define DISPLAY_NS_TO_CYCLES(ns)    (((ns) * DISPLAY_CPU_MHZ + 999) / 1000)
+
+#define DISPLAY_T_CYCLE_NS          300     /* nWE fall to fall */
+#define DISPLAY_T_PWLW_NS           60      /* nWE low pulse width */
+#define DISPLAY_T_PWHW_NS           60      /* nWE high pulse width */
+#define DISPLAY_T_DSW_NS            40      /* data setup before nWE rises */
+
+/* A GPIO store takes two cycles on AHB1; each byte makes two of them */
+#define DISPLAY_GPIO_CYCLES         2
+#define DISPLAY_BYTE_STORE_CYCLES   (2 * DISPLAY_GPIO_CYCLES)
+
+/*
+ * GRAM burst timing, in CPU cycles: how long nMEM_WE is held low and then
+ * high for each byte.  The display latches data on the rising edge, and the
+ * data goes out with the falling one, so the low time is also the data
+ * setup time.  The high time pads each byte out to the full write cycle.
+ */
+#ifndef DISPLAY_WE_LOW_CYCLES
+#  define DISPLAY_WE_LOW_CYCLES \
+    DISPLAY_NS_TO_CYCLES(DISPLAY_T_PWLW_NS > DISPLAY_T_DSW_NS ? \
+                         DISPLAY_T_PWLW_NS : DISPLAY_T_DSW_NS)
+#endif
+
+#ifndef DISPLAY_WE_HIGH_CYCLES
+#  define DISPLAY_WE_HIGH_CYCLES \
+    (DISPLAY_NS_TO_CYCLES(DISPLAY_T_CYCLE_NS) - DISPLAY_WE_LOW_CYCLES - \
+     DISPLAY_BYTE_STORE_CYCLES)
+#endif
+
+_Static_assert(DISPLAY_WE_LOW_CYCLES >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_PWLW_NS),
+               "nMEM_WE low time is below tPWLW");
+_Static_assert(DISPLAY_WE_LOW_CYCLES >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_DSW_NS),
+               "Data setup time is below tDSW");
+_Static_assert(DISPLAY_WE_HIGH_CYCLES >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_PWHW_NS),
+               "nMEM_WE high time is below tPWHW");
+_Static_assert(DISPLAY_WE_LOW_CYCLES + DISPLAY_WE_HIGH_CYCLES + DISPLAY_BYTE_STORE_CYCLES >=
+               DISPLAY_NS_TO_CYCLES(DISPLAY_T_CYCLE_NS),
+               "nMEM_WE write cycle is below tcycle");
+
+#ifndef EMULATOR
+#  define DISPLAY_DELAY(cycles)     __asm__ volatile(".rept %c0\n\tnop\n\t.endr" :: "i"(cycles))
+#else
+/*
+ * Host model of the bus, for comparing write sequences: a GPIO store is
+ * charged DISPLAY_GPIO_CYCLES and a nop one.  Loads and loop overhead are
+ * not counted, so the model is the fastest the bus could go, and it checks
+ * the write timing against that.
+ */
+#  define DISPLAY_MODEL(stores, nops) \
+    (display_cycles += (stores) * DISPLAY_GPIO_CYCLES + (nops))
+
+static uint32_t display_bytes = 0;
+static uint64_t display_cycles = 0;
+static uint64_t display_we_fall = 0;
+static uint64_t display_we_rise = 0;
+#endif
+
+/*
+ * display_bus_begin() - Select the display for a run of byte writes
  *
  * INPUT
- *     - reg: display register value
+ *     - data: true for display RAM and command parameters, false for a
+ *       command
  * OUTPUT
  *     none
  */
-static void display_write_reg(uint8_t reg)
+static void display_bus_begin(bool data)
 {
 #ifndef EMULATOR
-    /* Set up the data */
-    GPIO_BSRR(GPIOA) = 0x000000FF & (uint32_t)reg;
-
     /* Set nOLED_SEL low, nMEM_OE high, and nMEM_WE high. */
     CLEAR_PIN(nSEL_PIN);
     SET_PIN(nOE_PIN);
     SET_PIN(nWE_PIN);
 
-    __asm__("nop");
-    __asm__("nop");
+    DISPLAY_DELAY(2);
 
-    /* Set nDC low */
-    CLEAR_PIN(nDC_PIN);
+    /* Set nDC high for data, low for a command */
+    if(data)
+    {
+        SET_PIN(nDC_PIN);
+    }
+    else
+    {
+        CLEAR_PIN(nDC_PIN);
+    }
 
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
+    DISPLAY_DELAY(4);
+#else
+    (void)data;
+    DISPLAY_MODEL(4, 6);
+#endif
+}
 
-    /* Set nMEM_WE low */
-    CLEAR_PIN(nWE_PIN);
+/*
+ * display_bus_byte() - Write one byte while the display is selected.  Only
+ * nMEM_WE toggles.
+ *
+ * INPUT
+ *     - val: byte to write
+ * OUTPUT
+ *     none
+ */
+static void display_bus_byte(uint8_t val)
+{
+#ifndef EMULATOR
+    /* Drive all eight data lines and set nMEM_WE low in one store */
+    GPIO_BSRR(GPIOA) = (uint32_t)val | ((uint32_t)(uint8_t)~val << 16) |
+                       ((uint32_t)nWE_PIN.pin << 16);
 
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
+    DISPLAY_DELAY(DISPLAY_WE_LOW_CYCLES);
 
-    /* Set nMEM_WE high */
+    /* Set nMEM_WE high, latching the byte */
     SET_PIN(nWE_PIN);
 
-    __asm__("nop");
-    __asm__("nop");
+    DISPLAY_DELAY(DISPLAY_WE_HIGH_CYCLES);
+#else
+    (void)val;
+
+    /* nMEM_WE falls, with the data, as the first store lands */
+    DISPLAY_MODEL(1, 0);
+    assert(display_bytes == 0 ||
+           (display_cycles - display_we_fall >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_CYCLE_NS) &&
+            display_cycles - display_we_rise >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_PWHW_NS)));
+    display_we_fall = display_cycles;
+
+    /* and rises as the second one does */
+    DISPLAY_MODEL(1, DISPLAY_WE_LOW_CYCLES);
+    assert(display_cycles - display_we_fall >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_PWLW_NS) &&
+           display_cycles - display_we_fall >= DISPLAY_NS_TO_CYCLES(DISPLAY_T_DSW_NS));
+    display_we_rise = display_cycles;
+
+    DISPLAY_MODEL(0, DISPLAY_WE_HIGH_CYCLES);
+    display_bytes++;
+#endif
+}
 
+/*
+ * display_bus_bytes() - Write a run of bytes while the display is selected
+ *
+ * INPUT
+ *     - data: bytes to write
+ *     - len: number of bytes
+ * OUTPUT
+ *     none
+ */
+static void display_bus_bytes(const uint8_t *data, uint16_t len)
+{
+    for(; len >= 4; len -= 4)
+    {
+        display_bus_byte(data[ 0 ]);
+        display_bus_byte(data[ 1 ]);
+        display_bus_byte(data[ 2 ]);
+        display_bus_byte(data[ 3 ]);
+        data += 4;
+    }
+
+    while(len--)
+    {
+        display_bus_byte(*data++);
+    }
+}
+
+/*
+ * display_bus_end() - Deselect the display after a run of byte writes
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void display_bus_end(void)
+{
+#ifndef EMULATOR
     /* Set nOLED_SEL high */
     SET_PIN(nSEL_PIN);
     GPIO_BSRR(GPIOA) = 0x00FF0000;
 
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
+    DISPLAY_DELAY(4);
+#else
+    DISPLAY_MODEL(2, 4);
 #endif
 }
 
+/*
+ * display_write_reg() - Write data to display register
+ *
+ * INPUT
+ *     - reg: display register value
+ * OUTPUT
+ *     none
+ */
+static void display_write_reg(uint8_t reg)
+{
+    display_bus_begin(false);
+    display_bus_byte(reg);
+    display_bus_end();
+}
+
 /*
  * display_reset() - Reset display io port
  *
@@ -192,13 +341,11 @@ static void display_configure_io(void)
  */
 static void display_prepare_gram_write(void)
 {
-#ifndef EMULATOR
     display_write_reg((uint8_t)0x5C);
-#endif
 }
 
 /*
- * display_write_ram() - Write data to display
+ * display_write_ram() - Write one data byte to the display
  *
  * INPUT
  *     - val: display ram value
@@ -207,50 +354,37 @@ static void display_prepare_gram_write(void)
  */
 static void display_write_ram(uint8_t val)
 {
-#ifndef EMULATOR
-    /* Set up the data */
-    GPIO_BSRR(GPIOA) = 0x000000FF & (uint32_t)val;
-
-    /* Set nOLED_SEL low, nMEM_OE high, and nMEM_WE high. */
-    CLEAR_PIN(nSEL_PIN);
-    SET_PIN(nOE_PIN);
-    SET_PIN(nWE_PIN);
-
-    __asm__("nop");
-    __asm__("nop");
-
-    /* Set nDC high */
-    SET_PIN(nDC_PIN);
-
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-
-    /* Set nMEM_WE low */
-    CLEAR_PIN(nWE_PIN);
-
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-
-    /* Set nMEM_WE high */
-    SET_PIN(nWE_PIN);
-
-    __asm__("nop");
-    __asm__("nop");
+    display_bus_begin(true);
+    display_bus_byte(val);
+    display_bus_end();
+}
 
-    /* Set nOLED_SEL high */
-    SET_PIN(nSEL_PIN);
-    GPIO_BSRR(GPIOA) = 0x00FF0000;
+/*
+ * display_set_window() - Limit GRAM writes to a rectangle.  Writes fill it
+ * row by row, left to right.
+ *
+ * INPUT
+ *     - x: left column, a multiple of 4
+ *     - y: top row
+ *     - width: width in pixels, a multiple of 4
+ *     - height: height in rows
+ * OUTPUT
+ *     none
+ */
+static void display_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    /* Columns are in units of 4 pixels (2 bytes at 4 bits/pixel) */
+    uint8_t col_start = START_COL + x / 4;
+    uint8_t col_end = col_start + width / 4 - 1;
+    uint8_t row_start = START_ROW + y;
+    uint8_t row_end = row_start + height - 1;
 
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-#endif
+    display_write_reg((uint8_t)0x75);
+    display_write_ram(row_start);
+    display_write_ram(row_end);
+    display_write_reg((uint8_t)0x15);
+    display_write_ram(col_start);
+    display_write_ram(col_end);
 }
 
 /* === Functions =========================================================== */
@@ -269,7 +403,7 @@ Canvas *display_canvas_init(void)
     canvas.buffer   = canvas_buffer;
     canvas.width    = KEEPKEY_DISPLAY_WIDTH;
     canvas.height   = KEEPKEY_DISPLAY_HEIGHT;
-    canvas.dirty    = false;
+    canvas_clean(&canvas);
 
     return &canvas;
 }
@@ -288,7 +422,7 @@ Canvas *display_canvas(void)
 }
 
 /*
- * display_refresh() - Refresh display
+ * display_refresh() - Send the changed part of the canvas to the display
  *
  * INPUT
  *     none
@@ -302,29 +436,74 @@ void display_refresh(void)
         return;
     }
 
-    display_prepare_gram_write();
+    /* The window can only start and end on whole columns of 4 pixels */
+    uint16_t left = canvas.dirty_left & ~3;
+    uint16_t right = (canvas.dirty_right + 3) & ~3;
+    uint16_t top = canvas.dirty_top;
+    uint16_t bottom = canvas.dirty_bottom;
+    uint16_t stride = CANVAS_STRIDE(canvas.width);
+    uint16_t y;
 
-    int num_writes = canvas.width * canvas.height;
-
-    int i;
 #ifdef INVERT_DISPLAY
+    display_set_window(canvas.width - right, canvas.height - bottom,
+                       right - left, bottom - top);
+    display_prepare_gram_write();
+    display_bus_begin(true);
 
-    for(i = num_writes; i > 0; i -= 2)
+    for(y = bottom; y-- > top;)
     {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i - 1 ] >> 4);
+        const uint8_t *row = &canvas.buffer[ y * stride ];
+        uint16_t x;
+
+        for(x = right / 2; x-- > left / 2;)
+        {
+            display_bus_byte((uint8_t)((row[ x ] << 4) | (row[ x ] >> 4)));
+        }
+    }
 #else
+    display_set_window(left, top, right - left, bottom - top);
+    display_prepare_gram_write();
+    display_bus_begin(true);
 
-    for(i = 0; i < num_writes; i += 2)
+    for(y = top; y < bottom; y++)
     {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i + 1 ] >> 4);
-#endif
-        display_write_ram(v);
+        display_bus_bytes(&canvas.buffer[ y * stride + left / 2 ], (right - left) / 2);
     }
+#endif
 
+    display_bus_end();
+    canvas_clean(&canvas);
+}
 
-    canvas.dirty = false;
+#ifdef EMULATOR
+/*
+ * display_bytes_written() - Count of bytes sent to the display, commands
+ * included, for measuring refreshes on the emulator
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     bytes written since startup
+ */
+uint32_t display_bytes_written(void)
+{
+    return display_bytes;
 }
 
+/*
+ * display_bus_cycles() - Modelled CPU cycles spent driving the display bus
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     cycles since startup
+ */
+uint64_t display_bus_cycles(void)
+{
+    return display_cycles;
+}
+#endif
+
 /*
  * display_turn_on() - Turn on display
  *
@@ -388,21 +567,7 @@ void display_hw_init(void)
     display_write_reg((uint8_t)0xA1);
     display_write_ram((uint8_t)0x00);
 
-
-    uint8_t row_start = START_ROW;
-    uint8_t row_end = row_start + 64 - 1;
-
-    /* Width is in units of 4 pixels/column (2 bytes at 4 bits/pixel) */
-    int width = (256 / 4);
-    uint8_t col_start = START_COL;
-    uint8_t col_end = col_start + width - 1;
-
-    display_write_reg((uint8_t)0x75);
-    display_write_ram(row_start);
-    display_write_ram(row_end);
-    display_write_reg((uint8_t)0x15);
-    display_write_ram(col_start);
-    display_write_ram(col_end);
+    display_set_window(0, 0, KEEPKEY_DISPLAY_WIDTH, KEEPKEY_DISPLAY_HEIGHT);
 
     /* Horizontal address increment */
     /* Disable colum address re-map */
@@ -462,11 +627,15 @@ void display_hw_init(void)
     int end = 64  * 256;
     int i;
 
+    display_bus_begin(true);
+
     for(i = 0; i < end; i += 2)
     {
-        display_write_ram((uint8_t)0x00);
+        display_bus_byte((uint8_t)0x00);
     }
 
+    display_bus_end();
+
     /* Turn on 12V */
     SET_PIN(BACKLIGHT_PWR_PIN);
 
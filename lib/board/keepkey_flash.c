@@ -21,6 +21,8 @@
 
 #ifndef EMULATOR
 #  include <libopencm3/stm32/flash.h>
+#else
+#  include "keepkey/board/flash_sim.h"
 #endif
 
 #include "keepkey/board/keepkey_flash.h"
@@ -67,7 +69,6 @@ uint32_t flash_write_helper(Allocation group)
  */
 bool flash_chk_status(void)
 {
-#ifndef EMULATOR
     if(FLASH_SR & (FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_WRPERR)) {
         /* Flash error detected */
         return(false);
@@ -75,9 +76,6 @@ bool flash_chk_status(void)
         /* Flash operation successful */
         return(true);
     }
-#else
-    return true;
-#endif
 }
 
 /*
@@ -90,7 +88,6 @@ bool flash_chk_status(void)
  */
 void flash_erase_word(Allocation group)
 {
-#ifndef EMULATOR
     const FlashSector* s = flash_sector_map;
     while(s->use != FLASH_INVALID)
     {
@@ -99,7 +96,6 @@ void flash_erase_word(Allocation group)
         }
         ++s;
     }
-#endif
 }
 
 /*
@@ -112,7 +108,6 @@ void flash_erase_word(Allocation group)
  */
 void flash_erase(Allocation group)
 {
-#ifndef EMULATOR
     const FlashSector* s = flash_sector_map;
     while(s->use != FLASH_INVALID)
     {
@@ -121,95 +116,107 @@ void flash_erase(Allocation group)
         }
         ++s;
     }
-#endif
 }
 
 /*
- * flash_write_word() - Flash write in word (32bit) size
+ * flash_program_bytes() - Program bytes one at a time, reading each back
+ *
+ * INPUT
+ *     - address: flash address
+ *     - data: pointer to source data
+ *     - len: length of source data
+ * OUTPUT:
+ *     true/false whether flash now holds the data
+ */
+static bool flash_program_bytes(uint32_t address, const uint8_t *data, uint32_t len)
+{
+    volatile const uint8_t *dst = (volatile const uint8_t *)(uintptr_t)address;
+    uint32_t i;
+
+    for(i = 0; i < len; i++)
+    {
+        /* Bytes flash already holds cost nothing */
+        if(dst[i] != data[i]) {
+            flash_program_byte(address + i, data[i]);
+        }
+
+        if(flash_chk_status() == false || dst[i] != data[i]) {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+/*
+ * flash_write_word() - Flash write in word (32bit) size.  Unaligned head and
+ * tail bytes are programmed one at a time, everything between a word (x32,
+ * the widest parallelism at supply voltage) at a time.  Every byte is read
+ * back as it is programmed, so callers need no separate verify pass.
  *
  * INPUT
  *     - group: functional group
  *     - offset: flash address offset
  *     - len: length of source data
- *     - data: pointer to source data 
+ *     - data: pointer to source data
  * OUTPUT:
- *     true/false status of write
+ *     true/false whether flash now holds the data
  */
 bool flash_write_word(Allocation group, uint32_t offset, uint32_t len, uint8_t *data)
 {
-#ifndef EMULATOR
-    bool retval = true;
-    uint32_t start = flash_write_helper(group);
-    uint32_t data_word[1];
-    uint32_t i, align_cnt = 0;
-
-    start += offset ;
-
-    /* Byte writes for flash start address not long-word aligned */
-    if(start % sizeof(uint32_t)) {
-        align_cnt = sizeof(uint32_t) - start % sizeof(uint32_t);
-        flash_program(start, data, align_cnt);
-        if(flash_chk_status() == false) {
-            retval = false;
-            goto fww_exit;
-        }
-        /* Update new start address/data & len */
-        start += align_cnt;
-        data += align_cnt;
-        len -= align_cnt;
+    uint32_t start = flash_write_helper(group) + offset;
+    uint32_t head = (sizeof(uint32_t) - start % sizeof(uint32_t)) % sizeof(uint32_t);
+    uint32_t data_word;
+
+    if(head > len) {
+        head = len;
     }
 
-    /* Long word writes */
-    for(i = 0 ; i < len/sizeof(uint32_t); i++)
+    if(!flash_program_bytes(start, data, head)) {
+        return(false);
+    }
+
+    start += head;
+    data += head;
+    len -= head;
+
+    for(; len >= sizeof(uint32_t); len -= sizeof(uint32_t))
     {
-        memcpy(data_word, data, sizeof(uint32_t));
-	    flash_program_word(start, *data_word);
-	    // check flash status register for error condition
-        if(flash_chk_status() == false) {
-            retval = false;
-            goto fww_exit;
+        volatile const uint32_t *dst = (volatile const uint32_t *)(uintptr_t)start;
+
+        memcpy(&data_word, data, sizeof(uint32_t));
+
+        if(*dst != data_word) {
+            flash_program_word(start, data_word);
         }
+
+        // check flash status register for error condition
+        if(flash_chk_status() == false || *dst != data_word) {
+            return(false);
+        }
+
         start += sizeof(uint32_t);
         data += sizeof(uint32_t);
     }
 
-    /* Byte write for last remaining bytes < longword */
-    if(len % sizeof(uint32_t)) {
-        flash_program(start, data, len % sizeof(uint32_t));
-        if(flash_chk_status() == false) {
-            retval = false;
-        }
-    }
-fww_exit:
-    return(retval);
-#endif
-    return false;
+    return(flash_program_bytes(start, data, len));
 }
 
 /*
- * flash_write() - Flash write in byte size
+ * flash_write() - Flash write of a byte buffer.  Goes through the same word
+ * programming as flash_write_word().
  *
- * INPUT : 
+ * INPUT :
  *     - group: functional group
  *     - offset: flash address offset
  *     - len: length of source data
  *     - data: source data address
  * OUTPUT:
- *     true/false status of write
+ *     true/false whether flash now holds the data
  */
 bool flash_write(Allocation group, uint32_t offset, uint32_t len, uint8_t* data)
 {
-#ifndef EMULATOR
-    bool retval = true;
-    uint32_t start = flash_write_helper(group);
-    flash_program(start + offset, data, len);
-    if(flash_chk_status() == false) {
-        retval = false;
-    }
-    return(retval);
-#else
-    return true;
-#endif
+    return(flash_write_word(group, offset, len, data));
 }
 
 /*
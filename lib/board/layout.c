@@ -43,6 +43,10 @@ static Canvas *canvas = NULL;
 static volatile bool animate_flag = false;
 static leaving_handler_t leaving_handler;
 
+/* Delta animation on the canvas and the last of its frames applied */
+static const DeltaAnimation *delta_shown = NULL;
+static int delta_frame_shown = -1;
+
 /* === Private Functions =================================================== */
 
 /*
@@ -350,12 +354,12 @@ void layout_notification_icon(NotificationType type, DrawableParams *sp)
             break;
 
         case NOTIFICATION_CONFIRM_ANIMATION: {
-            const VariantAnimation *anim = get_confirming_animation();
+            const DeltaAnimation *anim = get_confirming_animation();
 
             layout_add_animation(
-                &layout_animate_images,
+                &layout_animate_delta,
                 (void *)anim,
-                get_image_animation_duration(anim));
+                get_delta_animation_duration(anim));
             break;
         }
 
@@ -533,14 +537,13 @@ void layout_home_reversed(void)
  */
 void layout_loading(void)
 {
-    const VariantAnimation *loading_animation = get_loading_animation();
-    
+    const DeltaAnimation *loading_animation = get_loading_animation();
 
     call_leaving_handler();
     layout_clear();
 
     layout_add_animation(
-            &layout_animate_images, 
+            &layout_animate_delta,
             (void *)loading_animation, 
             0);
     force_animation_start();
@@ -630,6 +633,45 @@ void layout_animate_images(void *data, uint32_t duration, uint32_t elapsed)
     }
 }
 
+/*
+ * layout_animate_delta() - Animate delta frames on display
+ *
+ *     Frames are applied in order from the one on the canvas.  Starting,
+ *     looping or a cleared display redraws from a blank rectangle.
+ *
+ * INPUT
+ *     - data: pointer to delta animation
+ *     - duration: duration of the animation
+ *     - elapsed: delay before drawing the frame
+ * OUTPUT
+ *     none
+ */
+void layout_animate_delta(void *data, uint32_t duration, uint32_t elapsed)
+{
+    const DeltaAnimation *animation = (const DeltaAnimation *)data;
+
+    bool looping = duration == 0;
+    int frameNum = get_delta_animation_frame(animation, elapsed, looping);
+
+    if(frameNum == -1)
+    {
+        return;
+    }
+
+    if(animation != delta_shown || frameNum < delta_frame_shown)
+    {
+        canvas_fill(canvas, animation->x, animation->y, animation->w, animation->h, 0x00);
+        canvas_mark_dirty(canvas, animation->x, animation->y, animation->w, animation->h);
+        delta_shown = animation;
+        delta_frame_shown = -1;
+    }
+
+    while(delta_frame_shown < frameNum)
+    {
+        draw_delta_frame(canvas, animation, ++delta_frame_shown);
+    }
+}
+
 /*
  * layout_clear() - Clear animation queue and clear display
  *
@@ -656,6 +698,8 @@ void layout_clear(void)
  */
 void layout_clear_static(void)
 {
+    delta_shown = NULL;
+
     BoxDrawableParams bp;
     bp.width = canvas->width;
     bp.height = canvas->height;
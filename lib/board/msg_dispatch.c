@@ -21,6 +21,7 @@
 
 #include "keepkey/board/usb_driver.h"
 #include "keepkey/board/msg_dispatch.h"
+#include "keepkey/board/timer.h"
 #include "keepkey/board/variant.h"
 
 #include <nanopb.h>
@@ -28,11 +29,20 @@
 #include <assert.h>
 #include <string.h>
 
+/* === Defines ============================================================= */
+
+/* Longest wait for the next fragment of a message being decoded */
+#define RX_STREAM_TIMEOUT_MS 500
+
 /* === Private Variables =================================================== */
 
 static const MessagesMap_t *MessagesMap = NULL;
 static size_t map_size = 0;
+static bool map_mfr = false;
+static uint8_t *msg_decode_buffer = NULL;
+static size_t msg_decode_size = 0;
 static msg_failure_t msg_failure;
+static msg_idle_t msg_idle;
 
 #if DEBUG_LINK
 static msg_debug_link_get_state_t msg_debug_link_get_state;
@@ -43,6 +53,27 @@ static bool msg_tiny_flag = false;
 static CONFIDENTIAL uint8_t msg_tiny[MSG_TINY_BFR_SZ];
 static uint16_t msg_tiny_id = MSG_TINY_TYPE_ERROR; /* Default to error type */
 
+/* USB packet being filled by usb_write_pb() */
+typedef struct
+{
+    uint8_t packet[USB_SEGMENT_SIZE];
+    size_t pos;
+    usb_tx_handler_t usb_tx_handler;
+} UsbPacketStream;
+
+/* Message currently being decoded from USB segments.  The first segment is
+ * read in place; later fragments are staged here because the UsbMessage
+ * that carries them only lives as long as the rx callback.
+ */
+static struct
+{
+    bool active;
+    bool overrun;
+    const uint8_t *data;
+    size_t size;
+    uint8_t fragment[USB_SEGMENT_SIZE - 1];
+} rx_stream;
+
 /* === Variables =========================================================== */
 
 /* Allow mapped messages to reset message stack.  This variable by itself doesn't
@@ -74,9 +105,9 @@ static const MessagesMap_t *message_map_entry(MessageMapType type,
     {
         switch (m[msg_id].msg_perms) {
         case MFROnly:
-            return variant_isMFR() ? &m[msg_id] : NULL;
+            return map_mfr ? &m[msg_id] : NULL;
         case MFRProhibited:
-            return variant_isMFR() ? NULL : &m[msg_id];
+            return map_mfr ? NULL : &m[msg_id];
         case AnyVariant:
             return &m[msg_id];
         }
@@ -117,7 +148,52 @@ static const pb_field_t *message_fields(MessageMapType type, MessageType msg_id,
 }
 
 /*
- * usb_write_pb() - Add usb frame header info to message buffer and perform usb transmission
+ * usb_packet_write() - pb_ostream_t callback that sends USB packets as they
+ * fill up
+ *
+ * INPUT
+ *     - stream: stream being encoded
+ *     - buf: encoded bytes
+ *     - count: number of encoded bytes
+ * OUTPUT
+ *     true/false whether the bytes were sent
+ */
+static bool usb_packet_write(pb_ostream_t *stream, const uint8_t *buf, size_t count)
+{
+    UsbPacketStream *ps = (UsbPacketStream *)stream->state;
+
+    while(count > 0)
+    {
+        size_t n = sizeof(ps->packet) - ps->pos;
+
+        if(n > count)
+        {
+            n = count;
+        }
+
+        memcpy(ps->packet + ps->pos, buf, n);
+        ps->pos += n;
+        buf += n;
+        count -= n;
+
+        if(ps->pos == sizeof(ps->packet))
+        {
+            if(!(*ps->usb_tx_handler)(ps->packet, sizeof(ps->packet)))
+            {
+                return false;
+            }
+
+            /* Continuation fragments only carry the HID report type */
+            ps->pos = sizeof(UsbHeader);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * usb_write_pb() - Encode a message straight into USB packets, behind a usb
+ * frame header, and transmit them
  *
  * INPUT
  *     - fields: protocol buffer
@@ -132,39 +208,117 @@ static void usb_write_pb(const pb_field_t *fields, const void *msg, MessageType
 {
     assert(fields != NULL);
 
-    TrezorFrameBuffer framebuf;
-    memset(&framebuf, 0, sizeof(framebuf));
-    framebuf.frame.usb_header.hid_type = '?';
-    framebuf.frame.header.pre1 = '#';
-    framebuf.frame.header.pre2 = '#';
-    framebuf.frame.header.id = __builtin_bswap16(id);
+    size_t len;
+
+    if(!pb_get_encoded_size(&len, fields, msg) || len > MAX_FRAME_SIZE)
+    {
+        return;
+    }
+
+    UsbPacketStream ps;
+    TrezorFrame *frame = (TrezorFrame *)ps.packet;
+    frame->usb_header.hid_type = '?';
+    frame->header.pre1 = '#';
+    frame->header.pre2 = '#';
+    frame->header.id = __builtin_bswap16(id);
+    frame->header.len = __builtin_bswap32(len);
+    ps.pos = sizeof(TrezorFrame);
+    ps.usb_tx_handler = usb_tx_handler;
 
-    pb_ostream_t os = pb_ostream_from_buffer(framebuf.buffer,
-                      sizeof(framebuf.buffer));
+    pb_ostream_t os = { &usb_packet_write, &ps, len, 0 };
 
-    if(pb_encode(&os, fields, msg))
+    if(pb_encode(&os, fields, msg) && ps.pos > sizeof(UsbHeader))
     {
-        framebuf.frame.header.len = __builtin_bswap32(os.bytes_written);
-        (*usb_tx_handler)((uint8_t *)&framebuf, sizeof(framebuf.frame) + os.bytes_written);
+        /* Send the partly filled last packet */
+        memset(ps.packet + ps.pos, 0, sizeof(ps.packet) - ps.pos);
+        (*usb_tx_handler)(ps.packet, sizeof(ps.packet));
     }
 }
 
 /*
- * pb_parse() - Process USB message by protocol buffer
+ * usb_stream_read() - pb_istream_t callback that pulls message bytes out of
+ * USB segments as they arrive
+ *
+ * INPUT
+ *     - stream: stream being decoded
+ *     - buf: destination for the bytes, or NULL to discard them
+ *     - count: number of bytes wanted
+ * OUTPUT
+ *     true/false whether the bytes were read
+ */
+static bool usb_stream_read(pb_istream_t *stream, uint8_t *buf, size_t count)
+{
+    (void)stream;
+
+    uint32_t start = get_clock_ms();
+
+    while(count > 0)
+    {
+        if(rx_stream.overrun)
+        {
+            return false;
+        }
+
+        if(rx_stream.size == 0)
+        {
+            /* Wait for usb_rx_helper() to hand over the next fragment, but
+             * not forever if the host stops sending mid-message */
+            if(get_clock_ms() - start > RX_STREAM_TIMEOUT_MS)
+            {
+                rx_stream.overrun = true;
+                return false;
+            }
+
+            usb_poll();
+            continue;
+        }
+
+        start = get_clock_ms();
+
+        size_t n = count < rx_stream.size ? count : rx_stream.size;
+
+        if(buf)
+        {
+            memcpy(buf, rx_stream.data, n);
+            buf += n;
+        }
+
+        rx_stream.data += n;
+        rx_stream.size -= n;
+        count -= n;
+    }
+
+    return true;
+}
+
+/*
+ * pb_parse() - Decode a USB message straight from its segments
  *
  * INPUT
  *     - entry: pointer to message entry
- *     - msg: pointer to received message buffer
+ *     - contents: payload of the first segment
+ *     - contents_size: size of the first segment's payload
  *     - msg_size: size of message
  *     - buf: pointer to destination buffer
  * OUTPUT
  *     true/false whether protocol buffers were parsed successfully
  */
-static bool pb_parse(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size,
-                     uint8_t *buf)
+static bool pb_parse(const MessagesMap_t *entry, const uint8_t *contents,
+                     size_t contents_size, uint32_t msg_size, uint8_t *buf)
 {
-    pb_istream_t stream = pb_istream_from_buffer(msg, msg_size);
-    return(pb_decode(&stream, entry->fields, buf));
+    pb_istream_t stream = { &usb_stream_read, NULL, msg_size };
+
+    rx_stream.data = contents;
+    rx_stream.size = contents_size;
+    rx_stream.overrun = false;
+    rx_stream.active = true;
+
+    bool status = pb_decode(&stream, entry->fields, buf);
+
+    rx_stream.active = false;
+    rx_stream.size = 0;
+
+    return status;
 }
 
 /*
@@ -172,21 +326,25 @@ static bool pb_parse(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
  *
  * INPUT
  *     - entry: pointer to message entry
- *     - msg: pointer to received message buffer
+ *     - contents: payload of the first segment
+ *     - contents_size: size of the first segment's payload
  *     - msg_size: size of message
  * OUTPUT
  *     none
  *
  */
-static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
+static void dispatch(const MessagesMap_t *entry, const uint8_t *contents,
+                     size_t contents_size, uint32_t msg_size)
 {
-    static uint8_t decode_buffer[MAX_DECODE_SIZE] __attribute__((aligned(4)));
+    /* Checked on every build: the map and the buffer come from the caller */
+    bool status = entry->decode_size <= msg_decode_size &&
+                  pb_parse(entry, contents, contents_size, msg_size, msg_decode_buffer);
 
-    if(pb_parse(entry, msg, msg_size, decode_buffer))
+    if(status)
     {
         if(entry->process_func)
         {
-            entry->process_func(decode_buffer);
+            entry->process_func(msg_decode_buffer);
         }
         else
         {
@@ -205,15 +363,18 @@ static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
  *
  * INPUT
  *     - entry: pointer to message entry
- *     - msg: pointer to received message buffer
+ *     - contents: payload of the first segment
+ *     - contents_size: size of the first segment's payload
  *     - msg_size: size of message
  * OUTPUT
  *     none
  *
  */
-static void tiny_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
+static void tiny_dispatch(const MessagesMap_t *entry, const uint8_t *contents,
+                          size_t contents_size, uint32_t msg_size)
 {
-    bool status = pb_parse(entry, msg, msg_size, msg_tiny);
+    bool status = entry->decode_size <= sizeof(msg_tiny) &&
+                  pb_parse(entry, contents, contents_size, msg_size, msg_tiny);
 
     if(status)
     {
@@ -290,15 +451,14 @@ static void raw_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_
 void usb_rx_helper(UsbMessage *msg, MessageMapType type)
 {
     static TrezorFrameHeaderFirst last_frame_header = { .id = 0xffff, .len = 0 };
-    static uint8_t content_buf[MAX_FRAME_SIZE];
     static size_t content_pos = 0, content_size = 0;
     static bool mid_frame = false;
+    static const MessagesMap_t *entry = NULL;
 
-    const MessagesMap_t *entry;
     TrezorFrame *frame = (TrezorFrame *)(msg->message);
     TrezorFrameFragment *frame_fragment  = (TrezorFrameFragment *)(msg->message);
 
-    bool last_segment;
+    bool first_segment, last_segment;
     uint8_t *contents;
 
     assert(msg != NULL);
@@ -321,7 +481,10 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         /* Init content pos and size */
         content_pos = msg->len - 9;
         content_size = content_pos;
+        first_segment = true;
 
+        /* Look up the handler once; fragments reuse it */
+        entry = message_map_entry(type, last_frame_header.id, IN_MSG);
     }
     else if(mid_frame)
     {
@@ -329,6 +492,7 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         if (check_uadd_overflow(content_pos, (size_t)(msg->len - 1), &content_pos))
             goto reset;
         content_size = msg->len - 1;
+        first_segment = false;
     }
     else
     {
@@ -338,9 +502,6 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
     last_segment = content_pos >= last_frame_header.len;
     mid_frame = !last_segment;
 
-    /* Determine callback handler and message map type */
-    entry = message_map_entry(type, last_frame_header.id, IN_MSG);
-
     if(entry && entry->dispatch == RAW)
     {
         /* Call dispatch for every segment since we are not buffering and parsing, and
@@ -349,42 +510,52 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
          */
         raw_dispatch(entry, contents, content_size, last_frame_header.len);
     }
-    else if(entry)
+    else if(!entry)
     {
-        size_t offset, len;
-        if (content_size == content_pos) {
-            offset = 0;
-            len = content_size;
-        } else {
-            offset = content_pos - (msg->len - 1);
-            len = msg->len - 1;
+        if(last_segment)
+        {
+            (*msg_failure)(FailureType_Failure_UnexpectedMessage, "Unknown message");
         }
-
-        size_t end;
-        if (check_uadd_overflow(offset, len, &end) || sizeof(content_buf) < end)
-            goto reset;
-
-        /* Copy content to frame buffer */
-        memcpy(content_buf + offset, contents, len);
     }
-
-    /*
-     * Only parse and message map if all segments have been buffered
-     * and this message type is parsable
-     */
-    if(last_segment && !entry)
+    else if(!first_segment)
     {
-        (*msg_failure)(FailureType_Failure_UnexpectedMessage, "Unknown message");
+        /*
+         * Hand the fragment to the decode waiting on it in usb_stream_read().
+         * Fragments of a message whose decode already failed are dropped.
+         */
+        if(rx_stream.active)
+        {
+            if(rx_stream.size != 0 || content_size > sizeof(rx_stream.fragment))
+            {
+                rx_stream.overrun = true;
+            }
+            else
+            {
+                memcpy(rx_stream.fragment, contents, content_size);
+                rx_stream.data = rx_stream.fragment;
+                rx_stream.size = content_size;
+            }
+        }
     }
-    else if(last_segment && entry->dispatch != RAW)
+    else
     {
+        if(last_frame_header.len > MAX_FRAME_SIZE)
+        {
+            goto reset;
+        }
+
+        /*
+         * Decode while the rest of the message arrives.  usb_stream_read()
+         * polls for the remaining fragments, which re-enter this function
+         * through the branch above.
+         */
         if(msg_tiny_flag)
         {
-            tiny_dispatch(entry, content_buf, last_frame_header.len);
+            tiny_dispatch(entry, contents, content_size, last_frame_header.len);
         }
         else
         {
-            dispatch(entry, content_buf, last_frame_header.len);
+            dispatch(entry, contents, content_size, last_frame_header.len);
         }
     }
     goto done_handling;
@@ -392,10 +563,10 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
 reset:
     last_frame_header.id = 0xffff;
     last_frame_header.len = 0;
-    memset(content_buf, 0, sizeof(content_buf));
     content_pos = 0;
     content_size = 0;
     mid_frame = false;
+    entry = NULL;
 
 done_handling:
     return;
@@ -444,12 +615,16 @@ static MessageType tiny_msg_poll_and_buffer(bool block, uint8_t *buf)
     msg_tiny_id = MSG_TINY_TYPE_ERROR;
     msg_tiny_flag = true;
 
-    // TODO: wire the emulator up so it advertises itself on HID
-#ifndef EMULATOR
     while(msg_tiny_id == MSG_TINY_TYPE_ERROR)
     {
         usb_poll();
 
+        /* Confirm, PIN and passphrase screens wait here for the host */
+        if(msg_idle)
+        {
+            (*msg_idle)();
+        }
+
         if(!block)
         {
             break;
@@ -462,7 +637,6 @@ static MessageType tiny_msg_poll_and_buffer(bool block, uint8_t *buf)
     {
         memcpy(buf, msg_tiny, sizeof(msg_tiny));
     }
-#endif
 
     return(msg_tiny_id);
 }
@@ -475,14 +649,24 @@ static MessageType tiny_msg_poll_and_buffer(bool block, uint8_t *buf)
  * INPUT
  *     - map: pointer message map array
  *     - size: size of message map
+ *     - decode_buffer: buffer parsable messages are decoded into, at least
+ *       as large as the largest decode_size in the map
+ *     - decode_buffer_size: size of decode buffer
  * OUTPUT
  *
  */
-void msg_map_init(const void *map, const size_t size)
+void msg_map_init(const void *map, const size_t size, void *decode_buffer,
+                  size_t decode_buffer_size)
 {
     assert(map != NULL);
+    assert(decode_buffer != NULL);
     MessagesMap = map;
     map_size = size;
+    msg_decode_buffer = decode_buffer;
+    msg_decode_size = decode_buffer_size;
+
+    /* The variant is fixed at link time, so resolve permissions once */
+    map_mfr = variant_isMFR();
 }
 
 /*
@@ -498,6 +682,20 @@ void set_msg_failure_handler(msg_failure_t failure_func)
     msg_failure = failure_func;
 }
 
+/*
+ * set_msg_idle_handler() - Setup handler for background work while waiting
+ * on the host for a tiny message
+ *
+ * INPUT
+ *     - idle_func: idle handler
+ * OUTPUT
+ *     none
+ */
+void set_msg_idle_handler(msg_idle_t idle_func)
+{
+    msg_idle = idle_func;
+}
+
 /*
  * set_msg_debug_link_get_state_handler() - Setup usb message debug link get state handler
  *
@@ -559,9 +757,7 @@ void call_msg_debug_link_get_state_handler(DebugLinkGetState *msg)
  */
 void msg_init(void)
 {
-#ifndef EMULATOR
     usb_set_rx_callback(handle_usb_rx);
-#endif
 #if DEBUG_LINK
     usb_set_debug_rx_callback(handle_debug_usb_rx);
 #endif
@@ -578,8 +774,6 @@ void msg_init(void)
  */
 bool msg_write(MessageType msg_id, const void *msg)
 {
-    // TODO: wire up the emulator to HID
-#ifndef EMULATOR
     const pb_field_t *fields = message_fields(NORMAL_MSG, msg_id, OUT_MSG);
 
     if(!fields)    // unknown message
@@ -589,7 +783,6 @@ bool msg_write(MessageType msg_id, const void *msg)
 
     /* add frame header to message and transmit out to usb */
     usb_write_pb(fields, msg, msg_id, &usb_tx);
-#endif
     return(true);
 }
 
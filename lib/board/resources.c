@@ -34,931 +34,20 @@ static const uint8_t confirm_icon_data[240] =
 static const Image confirm_icon_image = {22, 18, sizeof(confirm_icon_data), confirm_icon_data};
 const AnimationFrame confirm_icon_frame = {233, 4, 20, 100, &confirm_icon_image};
 
-/* --- Confirming Animation ------------------------------------------------ */
-static const uint8_t confirming_1_data[240] =
-{
-    0x32, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x6c, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x22, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x32, 0x00
-};
-static const Image confirming_1_image = {22, 22, sizeof(confirming_1_data), confirming_1_data};
-
-static const uint8_t confirming_2_data[240] =
-{
-    0x32, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0x02, 0xfa, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0x02, 0x6c, 0x06, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xff, 0xd5, 0x02, 0x04, 0xff, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0a, 0x04, 0x00, 0xfe, 0x0a, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x22, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x56, 0x0a, 0x32, 0x00
-};
-static const Image confirming_2_image = {22, 22, sizeof(confirming_2_data), confirming_2_data};
-
-static const uint8_t confirming_3_data[248] =
-{
-    0x32, 0x00, 0xf6, 0x05, 0x56, 0x97, 0xd5, 0xfa, 0x0f, 0xd5, 0x97, 0x56, 0x05, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0xff, 0x0f, 0x03, 0xff, 0xfe, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x05, 0xff, 0xff, 0x0f, 0x04, 0xff, 0xfe, 0xd5, 0x59, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0f, 0x05, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x05, 0xa3, 0x06, 0xff, 0xfe, 0x6c, 0x05, 0x06, 0xff, 0xfe, 0xa3, 0x05, 0x04, 0x00, 0xff, 0x56, 0x06, 0xff, 0xfc, 0xd5, 0x05, 0x00, 0xd5, 0x06, 0xff, 0xff, 0x56, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x49, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x12, 0x04, 0x00, 0xfe, 0x12, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x56, 0x08, 0x33, 0xff, 0x59, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x56, 0x10, 0xff, 0xff, 0x56, 0x04, 0x00, 0xfe, 0x05, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x05, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x05, 0x56, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x56, 0x05, 0x32, 0x00
-};
-static const Image confirming_3_image = {22, 22, sizeof(confirming_3_data), confirming_3_data};
-
-static const uint8_t confirming_4_data[251] =
-{
-    0x32, 0x00, 0xfb, 0x0a, 0x55, 0x97, 0xd5, 0xf1, 0x02, 0x0e, 0xfd, 0x97, 0x55, 0x0a, 0x0b, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x02, 0x0e, 0x02, 0xff, 0xfe, 0xa3, 0x41, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x02, 0x0e, 0x03, 0xff, 0xfe, 0xd5, 0x55, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x02, 0x0e, 0x04, 0xff, 0xfe, 0xd5, 0x41, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfd, 0x6b, 0x0a, 0x0e, 0x05, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x04, 0x00, 0xd5, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x41, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x0e, 0x04, 0x00, 0xfe, 0x0e, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x97, 0xd5, 0x02, 0xf1, 0xfc, 0xd5, 0x97, 0x55, 0x0a, 0x32, 0x00
-};
-static const Image confirming_4_image = {22, 22, sizeof(confirming_4_data), confirming_4_data};
-
-static const uint8_t confirming_5_data[252] =
-{
-    0x32, 0x00, 0xfb, 0x0a, 0x57, 0x97, 0xd5, 0xfa, 0x02, 0x0e, 0xfd, 0x0a, 0x33, 0x0a, 0x0b, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x03, 0x0e, 0xfd, 0xff, 0xa3, 0x49, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x03, 0x0e, 0x02, 0xff, 0xfe, 0xd5, 0x57, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x02, 0x0e, 0xff, 0x97, 0x03, 0xff, 0xfe, 0xd5, 0x49, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfd, 0x70, 0x0a, 0x0e, 0x05, 0xff, 0xfe, 0xa3, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x05, 0x00, 0x0e, 0x06, 0xff, 0xff, 0x57, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x20, 0x06, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x0e, 0x04, 0x00, 0xfe, 0x0e, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x57, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x57, 0x08, 0x33, 0xff, 0x57, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x57, 0x0a, 0x32, 0x00
-};
-static const Image confirming_5_image = {22, 22, sizeof(confirming_5_data), confirming_5_data};
-
-static const uint8_t confirming_6_data[249] =
-{
-    0x32, 0x00, 0xfb, 0x0a, 0x55, 0x99, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x45, 0xa6, 0x04, 0xff, 0x04, 0x10, 0xfe, 0xa6, 0x45, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x04, 0x10, 0xfd, 0xff, 0xe0, 0x55, 0x07, 0x00, 0xfe, 0x45, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x02, 0x10, 0x03, 0xff, 0xfe, 0xe0, 0x45, 0x05, 0x00, 0xfe, 0x0a, 0xa6, 0x06, 0xff, 0xfe, 0x6b, 0x0a, 0x02, 0x10, 0x04, 0xff, 0xfe, 0xa6, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xe0, 0x05, 0x00, 0x0e, 0x06, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x3d, 0x02, 0x00, 0xff, 0x05, 0x06, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xa6, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x3d, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa6, 0x0e, 0xff, 0xfe, 0xa6, 0x0a, 0x05, 0x00, 0xfe, 0x45, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x45, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa6, 0x08, 0xff, 0xfe, 0xa6, 0x45, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x99, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0x99, 0x55, 0x0a, 0x32, 0x00
-};
-static const Image confirming_6_image = {22, 22, sizeof(confirming_6_data), confirming_6_data};
-
-static const uint8_t confirming_7_data[249] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x55, 0x8c, 0xc2, 0xf1, 0x10, 0x0d, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x41, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0xe0, 0x55, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xff, 0xfa, 0x04, 0x10, 0x02, 0xff, 0xfe, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x0a, 0xa4, 0x06, 0xff, 0xfe, 0x8c, 0x0a, 0x02, 0x10, 0xff, 0xa4, 0x03, 0xff, 0xfe, 0xa4, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfb, 0xe0, 0x05, 0x00, 0x0d, 0x10, 0x05, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x8c, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x06, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa4, 0x04, 0x00, 0xff, 0xa4, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfe, 0xf1, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf1, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xff, 0x5e, 0x06, 0x00, 0xff, 0x5e, 0x04, 0xff, 0xff, 0xf1, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x8c, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x5e, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xa4, 0x0e, 0xff, 0xfe, 0xa4, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa4, 0x08, 0xff, 0xfe, 0xa4, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x8c, 0xc2, 0x02, 0xf1, 0xfc, 0xc2, 0x8c, 0x55, 0x0a, 0x32, 0x00
-};
-static const Image confirming_7_image = {22, 22, sizeof(confirming_7_data), confirming_7_data};
-
-static const uint8_t confirming_8_data[249] =
-{
-    0x32, 0x00, 0xf7, 0x09, 0x55, 0xa3, 0xc2, 0xf7, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x09, 0x00, 0xfe, 0x59, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x59, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x04, 0x10, 0xfd, 0xff, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x03, 0x10, 0x03, 0xff, 0xfe, 0xa3, 0x09, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfa, 0xe0, 0x09, 0x00, 0x0e, 0x10, 0x59, 0x04, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xfe, 0x04, 0x10, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x59, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x59, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x59, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x59, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x55, 0x09, 0x32, 0x00
-};
-static const Image confirming_8_image = {22, 22, sizeof(confirming_8_data), confirming_8_data};
-
-static const uint8_t confirming_9_data[249] =
-{
-    0x32, 0x00, 0xfb, 0x0b, 0x57, 0x97, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x0b, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0xe0, 0x41, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x6c, 0x05, 0x04, 0x10, 0x02, 0xff, 0xfe, 0xa3, 0x0b, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xe0, 0x05, 0x00, 0x0e, 0x02, 0x10, 0x04, 0xff, 0xff, 0x57, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xfe, 0x05, 0x10, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0xa3, 0x05, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xe0, 0x13, 0x04, 0x00, 0xfe, 0x13, 0xf7, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x6c, 0x04, 0xff, 0xff, 0xf7, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x57, 0x08, 0x33, 0xff, 0x57, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0b, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0x97, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0x97, 0x57, 0x0b, 0x32, 0x00
-};
-static const Image confirming_9_image = {22, 22, sizeof(confirming_9_data), confirming_9_data};
-
-static const uint8_t confirming_10_data[249] =
-{
-    0x32, 0x00, 0xfb, 0x0a, 0x55, 0x99, 0xc7, 0xee, 0x02, 0x0e, 0xfe, 0x0a, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x05, 0x09, 0x00, 0xfe, 0x55, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0e, 0x22, 0x05, 0x00, 0xfe, 0x0a, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x0a, 0x05, 0x10, 0xfd, 0xee, 0xb1, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xdf, 0x05, 0x00, 0x0e, 0x03, 0x10, 0x03, 0xff, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x02, 0x10, 0x04, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x0a, 0x05, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xfe, 0xee, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xee, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x0a, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x0a, 0x05, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x55, 0x99, 0xc7, 0x02, 0xee, 0xfc, 0xc7, 0x99, 0x55, 0x0a, 0x32, 0x00
-};
-static const Image confirming_10_image = {22, 22, sizeof(confirming_10_data), confirming_10_data};
-
-static const uint8_t confirming_11_data[246] =
-{
-    0x32, 0x00, 0xf7, 0x09, 0x55, 0x99, 0xc7, 0xee, 0x10, 0x0d, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x09, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xe0, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xe0, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x09, 0x06, 0x10, 0x02, 0x09, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xe0, 0x09, 0x00, 0x0d, 0x04, 0x10, 0xfd, 0xee, 0xff, 0x55, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x03, 0x10, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xfe, 0x09, 0xee, 0x04, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xfe, 0xee, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xee, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xee, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xee, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xe0, 0x0c, 0xff, 0xfe, 0xe0, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xe0, 0x0a, 0xff, 0xfe, 0xe0, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0x99, 0xc7, 0x02, 0xee, 0xfc, 0xc7, 0x99, 0x55, 0x09, 0x32, 0x00
-};
-static const Image confirming_11_image = {22, 22, sizeof(confirming_11_data), confirming_11_data};
-
-static const uint8_t confirming_12_data[244] =
-{
-    0x32, 0x00, 0xf7, 0x09, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x09, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x8a, 0x09, 0x06, 0x10, 0xff, 0x09, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x09, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x55, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x04, 0x10, 0x02, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xfe, 0x09, 0x10, 0x04, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x04, 0x00, 0xfe, 0x10, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x5e, 0x06, 0x00, 0xff, 0x5e, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x5e, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x09, 0x32, 0x00
-};
-static const Image confirming_12_image = {22, 22, sizeof(confirming_12_data), confirming_12_data};
-
-static const uint8_t confirming_13_data[245] =
-{
-    0x32, 0x00, 0xf7, 0x08, 0x55, 0x97, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x6b, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0x97, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x05, 0x10, 0xfe, 0x22, 0x97, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x08, 0x02, 0x10, 0xff, 0xa3, 0x02, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0x97, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x97, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0x97, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0x97, 0x55, 0x08, 0x32, 0x00
-};
-static const Image confirming_13_image = {22, 22, sizeof(confirming_13_data), confirming_13_data};
-
-static const uint8_t confirming_14_data[241] =
-{
-    0x32, 0x00, 0xf7, 0x08, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x8a, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x04, 0x10, 0xfe, 0x8a, 0xd5, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x10, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x6b, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x08, 0x32, 0x00
-};
-static const Image confirming_14_image = {22, 22, sizeof(confirming_14_data), confirming_14_data};
-
-static const uint8_t confirming_15_data[240] =
-{
-    0x32, 0x00, 0xf7, 0x08, 0x55, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x45, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x59, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x45, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x45, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x03, 0x10, 0xfd, 0xa3, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x59, 0x06, 0x00, 0xff, 0x59, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x08, 0x27, 0xff, 0x59, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x45, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x45, 0x07, 0x00, 0xfe, 0x59, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x59, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x55, 0x08, 0x32, 0x00
-};
-static const Image confirming_15_image = {22, 22, sizeof(confirming_15_data), confirming_15_data};
-
-static const uint8_t confirming_16_data[236] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xd5, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x03, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x57, 0x04, 0xff, 0xff, 0xfa, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xd5, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x22, 0xff, 0x57, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x0a, 0x05, 0x00, 0xfe, 0x49, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x49, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x49, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x57, 0x0a, 0x32, 0x00
-};
-static const Image confirming_16_image = {22, 22, sizeof(confirming_16_data), confirming_16_data};
-
-static const uint8_t confirming_17_data[234] =
-{
-    0x32, 0x00, 0xf7, 0x08, 0x55, 0x99, 0xc7, 0xfa, 0x10, 0x0d, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xb1, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0d, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xff, 0xfa, 0x06, 0x10, 0xfe, 0x0d, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xb1, 0x06, 0xff, 0xfe, 0x6b, 0x08, 0x06, 0x10, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x08, 0x05, 0x10, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xb1, 0x08, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x55, 0x08, 0x41, 0xff, 0x55, 0x03, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x55, 0x10, 0xff, 0xff, 0x55, 0x04, 0x00, 0xfe, 0x08, 0xb1, 0x0e, 0xff, 0xfe, 0xb1, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x55, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x55, 0x09, 0x00, 0xfe, 0x41, 0xb1, 0x08, 0xff, 0xfe, 0xb1, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x55, 0x99, 0xc7, 0x02, 0xfa, 0xfc, 0xc7, 0x99, 0x55, 0x08, 0x32, 0x00
-};
-static const Image confirming_17_image = {22, 22, sizeof(confirming_17_data), confirming_17_data};
-
-static const uint8_t confirming_18_data[241] =
-{
-    0x32, 0x00, 0xf7, 0x08, 0x4e, 0xa3, 0xd5, 0xfa, 0x0e, 0x0c, 0x08, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x03, 0x09, 0x00, 0xfe, 0x4e, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x08, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x03, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x4e, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x4e, 0x06, 0x00, 0xff, 0x08, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xfb, 0xc2, 0xff, 0xa3, 0x41, 0x0e, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x4e, 0x08, 0x41, 0xff, 0x4e, 0x03, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x4e, 0x10, 0xff, 0xff, 0x4e, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x4e, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x4e, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x4e, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x4e, 0x08, 0x32, 0x00
-};
-static const Image confirming_18_image = {22, 22, sizeof(confirming_18_data), confirming_18_data};
-
-static const uint8_t confirming_19_data[242] =
-{
-    0x32, 0x00, 0xf7, 0x08, 0x57, 0xa3, 0xc2, 0xf7, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x08, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x22, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x41, 0xff, 0x57, 0x02, 0xff, 0xfe, 0xc2, 0x22, 0x04, 0x00, 0xff, 0x57, 0x10, 0xff, 0xff, 0x57, 0x04, 0x00, 0xfe, 0x08, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x08, 0x05, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x08, 0x57, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x57, 0x08, 0x32, 0x00
-};
-static const Image confirming_19_image = {22, 22, sizeof(confirming_19_data), confirming_19_data};
-
-static const uint8_t confirming_20_data[243] =
-{
-    0x32, 0x00, 0xf7, 0x09, 0x57, 0xa3, 0xd5, 0xfa, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x7a, 0x09, 0x06, 0x10, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x09, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x04, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x08, 0x41, 0xfe, 0x57, 0xa3, 0x02, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x0f, 0xff, 0xfe, 0xfa, 0x22, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x09, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x57, 0xa3, 0xd5, 0x02, 0xfa, 0xfc, 0xd5, 0xa3, 0x57, 0x09, 0x32, 0x00
-};
-static const Image confirming_20_image = {22, 22, sizeof(confirming_20_data), confirming_20_data};
-
-static const uint8_t confirming_21_data[242] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x51, 0xa3, 0xd5, 0xea, 0x0e, 0x0c, 0x0a, 0x03, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x03, 0x09, 0x00, 0xfe, 0x51, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x41, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x03, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x51, 0x06, 0xff, 0xfc, 0xd5, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x51, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x51, 0x08, 0x41, 0xff, 0x22, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x51, 0x0e, 0xff, 0xfd, 0x51, 0x10, 0x03, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x0e, 0xff, 0xfe, 0xa3, 0x03, 0x05, 0x00, 0xfe, 0x41, 0xd5, 0x0c, 0xff, 0xfe, 0xd5, 0x41, 0x07, 0x00, 0xfe, 0x51, 0xd5, 0x0a, 0xff, 0xfe, 0xd5, 0x51, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x0a, 0x51, 0xa3, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xa3, 0x51, 0x0a, 0x32, 0x00
-};
-static const Image confirming_21_image = {22, 22, sizeof(confirming_21_data), confirming_21_data};
-
-static const uint8_t confirming_22_data[245] =
-{
-    0x32, 0x00, 0xfb, 0x0b, 0x55, 0xa3, 0xc2, 0xf7, 0x02, 0x0e, 0xfe, 0x07, 0x03, 0x0c, 0x00, 0xfe, 0x45, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x03, 0x09, 0x00, 0xfe, 0x55, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0e, 0x07, 0x07, 0x00, 0xfe, 0x45, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0e, 0x03, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x03, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x3f, 0x02, 0x00, 0xff, 0x03, 0x06, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x07, 0x3f, 0xfe, 0x22, 0x07, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x55, 0x0d, 0xff, 0x03, 0x10, 0xff, 0x03, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0d, 0xff, 0xfe, 0x78, 0x0b, 0x06, 0x00, 0xfe, 0x45, 0xdf, 0x0c, 0xff, 0xfe, 0xdf, 0x3f, 0x07, 0x00, 0xfe, 0x55, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x55, 0x09, 0x00, 0xfe, 0x45, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x45, 0x0b, 0x00, 0xfc, 0x0b, 0x55, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x55, 0x0b, 0x32, 0x00
-};
-static const Image confirming_22_image = {22, 22, sizeof(confirming_22_data), confirming_22_data};
-
-static const uint8_t confirming_23_data[238] =
-{
-    0x32, 0x00, 0xf7, 0x09, 0x57, 0xa3, 0xc2, 0xf7, 0x10, 0x0d, 0x09, 0x06, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x02, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x41, 0xdf, 0x05, 0xff, 0xff, 0xf7, 0x06, 0x10, 0xfe, 0x0d, 0x02, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x06, 0x00, 0x0d, 0x06, 0x10, 0xff, 0x06, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x02, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc2, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0x06, 0x10, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x06, 0x05, 0x10, 0x04, 0x00, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc2, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x07, 0x41, 0xfe, 0x02, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x0c, 0xff, 0x04, 0x10, 0xff, 0x06, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0c, 0xff, 0xfd, 0x41, 0x10, 0x0b, 0x06, 0x00, 0xfe, 0x41, 0xdf, 0x0c, 0xff, 0xfe, 0x78, 0x02, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x0a, 0xff, 0xfe, 0xdf, 0x57, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x57, 0xa3, 0xc2, 0x02, 0xf7, 0xfc, 0xc2, 0xa3, 0x57, 0x09, 0x32, 0x00
-};
-static const Image confirming_23_image = {22, 22, sizeof(confirming_23_data), confirming_23_data};
-
-static const uint8_t confirming_24_data[250] =
-{
-    0x32, 0x00, 0xf7, 0x09, 0x4e, 0xa3, 0xc6, 0xea, 0x0e, 0x0d, 0x09, 0x06, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x02, 0x09, 0x00, 0xfe, 0x4e, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x02, 0x05, 0x00, 0xfe, 0x09, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x09, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x4e, 0x06, 0xff, 0xfc, 0xc6, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x06, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x02, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x4e, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x4e, 0x06, 0x41, 0xfd, 0x0e, 0x02, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x4e, 0x0b, 0xff, 0xff, 0x41, 0x04, 0x10, 0xff, 0x06, 0x04, 0x00, 0xfe, 0x09, 0xa3, 0x0b, 0xff, 0xff, 0x41, 0x02, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x41, 0xc6, 0x0b, 0xff, 0xfd, 0x4e, 0x0d, 0x02, 0x07, 0x00, 0xfe, 0x4e, 0xc6, 0x0a, 0xff, 0xfe, 0xc6, 0x10, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x41, 0x0b, 0x00, 0xfc, 0x09, 0x4e, 0xa3, 0xc6, 0x02, 0xea, 0xfc, 0xc6, 0xa3, 0x4e, 0x09, 0x32, 0x00
-};
-static const Image confirming_24_image = {22, 22, sizeof(confirming_24_data), confirming_24_data};
-
-static const uint8_t confirming_25_data[249] =
-{
-    0x32, 0x00, 0xf7, 0x0b, 0x55, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x4c, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x55, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x4c, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xc6, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x4c, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x06, 0x2a, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x55, 0x0b, 0xff, 0x05, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xa3, 0x0a, 0xff, 0xff, 0xc6, 0x03, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x4c, 0xc6, 0x0a, 0xff, 0xfc, 0x55, 0x10, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x55, 0xc6, 0x0a, 0xff, 0xfe, 0x10, 0x05, 0x09, 0x00, 0xfe, 0x4c, 0xa3, 0x08, 0xff, 0xfe, 0xa3, 0x4c, 0x0b, 0x00, 0xfc, 0x0b, 0x55, 0xa3, 0xc6, 0x02, 0xea, 0xfc, 0xc6, 0xa3, 0x55, 0x0b, 0x32, 0x00
-};
-static const Image confirming_25_image = {22, 22, sizeof(confirming_25_data), confirming_25_data};
-
-static const uint8_t confirming_26_data[252] =
-{
-    0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xd5, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x49, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x49, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x79, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x06, 0x22, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x0a, 0xff, 0xff, 0x22, 0x05, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x0a, 0xff, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x49, 0xd5, 0x09, 0xff, 0xff, 0xb4, 0x02, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x09, 0xff, 0xfd, 0x22, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x49, 0xb4, 0x08, 0xff, 0xfe, 0xb4, 0x05, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xb4, 0x57, 0x0b, 0x32, 0x00
-};
-static const Image confirming_26_image = {22, 22, sizeof(confirming_26_data), confirming_26_data};
-
-static const uint8_t confirming_27_data[254] =
-{
-    0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xd5, 0xea, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x4d, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xd5, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x4d, 0xd5, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd5, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xd5, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd5, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x05, 0x27, 0xff, 0x10, 0x02, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x0a, 0xff, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x09, 0xff, 0xff, 0x4d, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x4d, 0xd5, 0x09, 0xff, 0x03, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xd5, 0x08, 0xff, 0xfc, 0x4d, 0x10, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x4d, 0xb4, 0x07, 0xff, 0xfd, 0xea, 0x0b, 0x05, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xd5, 0x02, 0xea, 0xfc, 0xd5, 0xb4, 0x57, 0x02, 0x32, 0x00
-};
-static const Image confirming_27_image = {22, 22, sizeof(confirming_27_data), confirming_27_data};
-
-static const uint8_t confirming_28_data[254] =
-{
-    0x32, 0x00, 0xf7, 0x0b, 0x57, 0xb4, 0xe3, 0xfa, 0x0e, 0x0c, 0x08, 0x05, 0x0c, 0x00, 0xfe, 0x57, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xe3, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x57, 0xe3, 0x05, 0xff, 0xfe, 0xfa, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0b, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xe3, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xe3, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0b, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xfe, 0xe3, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xfa, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xe3, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x05, 0x2b, 0x03, 0x02, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x57, 0x09, 0xff, 0xff, 0xb4, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0b, 0xb4, 0x09, 0xff, 0x05, 0x10, 0xff, 0x0b, 0x06, 0x00, 0xfe, 0x57, 0xe3, 0x08, 0xff, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xe3, 0x07, 0xff, 0xff, 0xb4, 0x02, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x57, 0xb4, 0x07, 0xff, 0xfd, 0x10, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x0b, 0x57, 0xb4, 0xe3, 0x02, 0xfa, 0xfd, 0xe3, 0xb4, 0x10, 0x33, 0x00
-};
-static const Image confirming_28_image = {22, 22, sizeof(confirming_28_data), confirming_28_data};
-
-static const uint8_t confirming_29_data[255] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x4d, 0x99, 0xbc, 0xf7, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x4d, 0xbc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x4d, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x4d, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xbc, 0x06, 0xff, 0xfe, 0x6b, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x4d, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0x99, 0x06, 0xff, 0xff, 0x4d, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xbc, 0x05, 0xff, 0xff, 0x99, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x4d, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xbc, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x99, 0x03, 0xff, 0xff, 0x4d, 0x05, 0x27, 0x03, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x4d, 0x09, 0xff, 0x07, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xbc, 0x08, 0xff, 0xff, 0x4d, 0x05, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x4d, 0xdf, 0x07, 0xff, 0xff, 0xdf, 0x04, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x4d, 0xdf, 0x07, 0xff, 0x03, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x4d, 0xbc, 0x06, 0xff, 0x02, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x4d, 0x99, 0xbc, 0x02, 0xf7, 0xfd, 0xbc, 0x27, 0x04, 0x33, 0x00
-};
-static const Image confirming_29_image = {22, 22, sizeof(confirming_29_data), confirming_29_data};
-
-static const uint8_t confirming_30_data[261] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xc6, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x41, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x04, 0x41, 0xff, 0x22, 0x03, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x08, 0xff, 0xff, 0xa3, 0x07, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x07, 0xff, 0xff, 0xa3, 0x06, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x41, 0xc6, 0x06, 0xff, 0xff, 0xa3, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x41, 0xa3, 0x04, 0xff, 0xff, 0xa3, 0x03, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0xa3, 0x0c, 0x0a, 0x04, 0x33, 0x00
-};
-static const Image confirming_30_image = {22, 22, sizeof(confirming_30_data), confirming_30_data};
-
-static const uint8_t confirming_31_data[252] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa3, 0xc6, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x49, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x49, 0xc6, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xc6, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xc6, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x57, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x08, 0xff, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x07, 0xff, 0x07, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x49, 0xc6, 0x06, 0xff, 0x06, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xc6, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x49, 0xa3, 0x03, 0xff, 0xff, 0xea, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfd, 0x0a, 0x57, 0xa3, 0x02, 0xc6, 0xfc, 0x0e, 0x0c, 0x0a, 0x04, 0x33, 0x00
-};
-static const Image confirming_31_image = {22, 22, sizeof(confirming_31_data), confirming_31_data};
-
-static const uint8_t confirming_32_data[256] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x55, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x3c, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x3c, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x3c, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x55, 0x04, 0x3c, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x08, 0xff, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xff, 0xea, 0x07, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x3c, 0xd1, 0x05, 0xff, 0xff, 0x78, 0x06, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x55, 0xd1, 0x04, 0xff, 0xff, 0x19, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x3c, 0xa9, 0x03, 0xff, 0x05, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfe, 0x0a, 0x55, 0x02, 0xa9, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
-};
-static const Image confirming_32_image = {22, 22, sizeof(confirming_32_data), confirming_32_data};
-
-static const uint8_t confirming_33_data[257] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xb4, 0xdf, 0xf7, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x49, 0xb4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xdf, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x49, 0xdf, 0x05, 0xff, 0xfe, 0xf7, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xb4, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xdf, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xb4, 0x06, 0xff, 0xff, 0x49, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xdf, 0x05, 0xff, 0xff, 0xb4, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xfe, 0xdf, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf7, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xdf, 0x03, 0xff, 0xff, 0xb4, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xb4, 0x03, 0xff, 0xff, 0x57, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x07, 0xff, 0xff, 0xb4, 0x08, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xb4, 0x06, 0xff, 0x08, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x49, 0xdf, 0x05, 0xff, 0x07, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xdf, 0x03, 0xff, 0xff, 0xb4, 0x06, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x49, 0xb4, 0x02, 0xff, 0xff, 0x22, 0x05, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x57, 0x78, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
-};
-static const Image confirming_33_image = {22, 22, sizeof(confirming_33_data), confirming_33_data};
-
-static const uint8_t confirming_34_data[256] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x56, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x0c, 0x00, 0xfe, 0x47, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x56, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x47, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x56, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x47, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x56, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x56, 0x04, 0x22, 0x04, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x56, 0x07, 0xff, 0x09, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x05, 0xff, 0xff, 0xea, 0x08, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x47, 0xd1, 0x04, 0xff, 0xff, 0x22, 0x07, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x56, 0xd1, 0x02, 0xff, 0xff, 0xea, 0x07, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfc, 0x47, 0xa9, 0xff, 0x56, 0x06, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x0a, 0x56, 0x0a, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x0a, 0x04, 0x33, 0x00
-};
-static const Image confirming_34_image = {22, 22, sizeof(confirming_34_data), confirming_34_data};
-
-static const uint8_t confirming_35_data[251] =
-{
-    0x32, 0x00, 0xf7, 0x0a, 0x57, 0xa9, 0xd1, 0xea, 0x0e, 0x0c, 0x09, 0x04, 0x0c, 0x00, 0xfe, 0x33, 0xa9, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x33, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa9, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa9, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa9, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa9, 0x03, 0xff, 0xff, 0x57, 0x03, 0x33, 0x05, 0x02, 0xff, 0x07, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x57, 0x07, 0xff, 0x09, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa9, 0x05, 0xff, 0x09, 0x10, 0xff, 0x0a, 0x06, 0x00, 0xfe, 0x33, 0xd1, 0x03, 0xff, 0xff, 0xa9, 0x08, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x57, 0xd1, 0x02, 0xff, 0x08, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfd, 0x33, 0xa9, 0x78, 0x07, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x07, 0x04, 0x09, 0x0c, 0x02, 0x0e, 0xfd, 0x0c, 0x09, 0x04, 0x33, 0x00
-};
-static const Image confirming_35_image = {22, 22, sizeof(confirming_35_data), confirming_35_data};
-
-static const uint8_t confirming_36_data[256] =
-{
-    0x32, 0x00, 0xf6, 0x0a, 0x57, 0xa8, 0xd1, 0xea, 0x0e, 0x0c, 0x0a, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x57, 0xa8, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x57, 0xd1, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x57, 0xd1, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa8, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0xfc, 0xd1, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa8, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xd1, 0x05, 0xff, 0xff, 0xa8, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x57, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xd1, 0x03, 0xff, 0xff, 0xa8, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa8, 0x03, 0xff, 0xff, 0x57, 0x03, 0x2b, 0x05, 0x03, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x57, 0x06, 0xff, 0x0a, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa8, 0x04, 0xff, 0xff, 0xa8, 0x09, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x57, 0xd1, 0x02, 0xff, 0xff, 0xea, 0x09, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfd, 0x57, 0xd1, 0xff, 0x09, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0xfe, 0x57, 0x2b, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x0a, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x0a, 0x04, 0x01, 0x32, 0x00
-};
-static const Image confirming_36_image = {22, 22, sizeof(confirming_36_data), confirming_36_data};
-
-static const uint8_t confirming_37_data[255] =
-{
-    0x32, 0x00, 0xf6, 0x0a, 0x55, 0xa3, 0xc7, 0xf3, 0x0e, 0x0c, 0x0a, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x55, 0xa3, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x55, 0xc7, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x07, 0x07, 0x00, 0xfe, 0x55, 0xc7, 0x05, 0xff, 0xfe, 0xf3, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xa3, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x55, 0x06, 0xff, 0xfc, 0xc7, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0xa3, 0x06, 0xff, 0xff, 0x2b, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0xc7, 0x05, 0xff, 0xff, 0xa3, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xfe, 0xf3, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xff, 0x55, 0x06, 0x00, 0xff, 0x07, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc7, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xa3, 0x03, 0xff, 0xff, 0x55, 0x03, 0x2b, 0x05, 0x03, 0xff, 0x07, 0x03, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xf3, 0x0a, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x0a, 0xa3, 0x03, 0xff, 0xff, 0xf3, 0x0a, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfc, 0x55, 0xc7, 0xff, 0xf3, 0x0a, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x55, 0xc7, 0x0a, 0x10, 0xfe, 0x0c, 0x07, 0x09, 0x00, 0x02, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x0a, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x0a, 0x04, 0x01, 0x32, 0x00
-};
-static const Image confirming_37_image = {22, 22, sizeof(confirming_37_data), confirming_37_data};
-
-static const uint8_t confirming_38_data[249] =
-{
-    0x32, 0x00, 0xff, 0x0a, 0x02, 0x78, 0xf9, 0xc0, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x33, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x78, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x33, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xc0, 0x06, 0xff, 0xfe, 0x78, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x78, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x78, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x78, 0x03, 0xff, 0x03, 0x33, 0x06, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x78, 0x05, 0xff, 0x0b, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0a, 0xc0, 0x03, 0xff, 0x0b, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfd, 0x33, 0xea, 0xc0, 0x0b, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x33, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_38_image = {22, 22, sizeof(confirming_38_data), confirming_38_data};
-
-static const uint8_t confirming_39_data[252] =
-{
-    0x32, 0x00, 0xfe, 0x0a, 0x76, 0x02, 0xb5, 0xfa, 0xe9, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x33, 0xb5, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x76, 0xe9, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x33, 0xe9, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xb5, 0x06, 0xff, 0xfe, 0x76, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xfc, 0xe9, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0xb5, 0x06, 0xff, 0xff, 0x33, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xb5, 0x05, 0xff, 0xff, 0xb5, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xe9, 0x04, 0xff, 0xfe, 0xe9, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xe9, 0x04, 0xff, 0xff, 0x76, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xb5, 0x03, 0xff, 0xff, 0xb5, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xb5, 0x03, 0xff, 0xff, 0x76, 0x02, 0x33, 0x06, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x76, 0x04, 0xff, 0xff, 0x33, 0x0b, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfc, 0x0a, 0xb5, 0xff, 0xe9, 0x0c, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x33, 0x76, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_39_image = {22, 22, sizeof(confirming_39_data), confirming_39_data};
-
-static const uint8_t confirming_40_data[248] =
-{
-    0x32, 0x00, 0xf6, 0x0a, 0x34, 0x79, 0xbc, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xbc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x79, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xbc, 0x06, 0xff, 0xfe, 0x79, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x79, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xbc, 0x05, 0xff, 0xff, 0xbc, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x79, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xbc, 0x03, 0xff, 0xff, 0xbc, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x79, 0x03, 0xff, 0x02, 0x34, 0x07, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x34, 0x02, 0xff, 0xff, 0xea, 0x0d, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfd, 0x0a, 0xbc, 0x79, 0x0d, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_40_image = {22, 22, sizeof(confirming_40_data), confirming_40_data};
-
-static const uint8_t confirming_41_data[245] =
-{
-    0x32, 0x00, 0xf6, 0x0a, 0x34, 0x7a, 0xc0, 0xea, 0x0e, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0a, 0x04, 0x09, 0x00, 0xfe, 0x7a, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x0a, 0xc0, 0x06, 0xff, 0xfe, 0x7a, 0x08, 0x06, 0x10, 0xfe, 0x0a, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x08, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x7a, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x7a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x7a, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x7a, 0x03, 0xff, 0xff, 0x34, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xfd, 0x34, 0xea, 0x7a, 0x0e, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x03, 0x0a, 0x0e, 0x10, 0xfe, 0x0a, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0a, 0x08, 0x10, 0xfe, 0x0a, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_41_image = {22, 22, sizeof(confirming_41_data), confirming_41_data};
-
-static const uint8_t confirming_42_data[243] =
-{
-    0x32, 0x00, 0xf6, 0x09, 0x34, 0x81, 0xc0, 0xea, 0x0e, 0x0d, 0x09, 0x04, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x34, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xc0, 0x06, 0xff, 0xfe, 0x81, 0x09, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x04, 0x04, 0x00, 0xff, 0x81, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x81, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x34, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xfb, 0x81, 0xff, 0xc0, 0x34, 0x04, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x04, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x04, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x04, 0x01, 0x32, 0x00
-};
-static const Image confirming_42_image = {22, 22, sizeof(confirming_42_data), confirming_42_data};
-
-static const uint8_t confirming_43_data[244] =
-{
-    0x32, 0x00, 0xf6, 0x09, 0x34, 0x82, 0xca, 0xf3, 0x0e, 0x0c, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xca, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x34, 0xca, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xca, 0x05, 0xff, 0xfe, 0xf3, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xca, 0x06, 0xff, 0xfe, 0x82, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xca, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x82, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xca, 0x05, 0xff, 0xff, 0x82, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xfe, 0xf3, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xf3, 0x04, 0xff, 0xff, 0x34, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xfb, 0xca, 0xff, 0xf3, 0xca, 0x34, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x0e, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0c, 0x0c, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0c, 0x0a, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_43_image = {22, 22, sizeof(confirming_43_data), confirming_43_data};
-
-static const uint8_t confirming_44_data[241] =
-{
-    0x32, 0x00, 0xf6, 0x09, 0x34, 0x7a, 0xc0, 0xea, 0x0e, 0x0c, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xc0, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x7a, 0xea, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0c, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xea, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0c, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xc0, 0x06, 0xff, 0xfe, 0x7a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x34, 0x06, 0xff, 0xfc, 0xea, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x7a, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x7a, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xfe, 0xea, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0xea, 0x04, 0xff, 0xff, 0x7a, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0x04, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0c, 0x0c, 0x10, 0xfe, 0x0c, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0c, 0x0a, 0x10, 0xfe, 0x0c, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0c, 0x02, 0x0e, 0xfc, 0x0c, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_44_image = {22, 22, sizeof(confirming_44_data), confirming_44_data};
-
-static const uint8_t confirming_45_data[239] =
-{
-    0x32, 0x00, 0xff, 0x09, 0x02, 0x6e, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x27, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x6e, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x27, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x6e, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x6e, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x6e, 0x06, 0xff, 0xff, 0x27, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xcc, 0x05, 0xff, 0xff, 0x6e, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0x06, 0xff, 0xff, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0x05, 0x27, 0xff, 0x0b, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_45_image = {22, 22, sizeof(confirming_45_data), confirming_45_data};
-
-static const uint8_t confirming_46_data[246] =
-{
-    0x32, 0x00, 0xff, 0x09, 0x02, 0x76, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x30, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x76, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x30, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x76, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x76, 0x06, 0xff, 0xff, 0x30, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0xcc, 0x05, 0xff, 0xff, 0x76, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0x02, 0x30, 0xfe, 0x76, 0xcc, 0x02, 0xff, 0xff, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_46_image = {22, 22, sizeof(confirming_46_data), confirming_46_data};
-
-static const uint8_t confirming_47_data[245] =
-{
-    0x32, 0x00, 0xff, 0x09, 0x02, 0x78, 0xf9, 0xcc, 0xff, 0x0e, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x34, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x78, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x34, 0xcc, 0x06, 0xff, 0xff, 0x0e, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x78, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x78, 0x06, 0xff, 0xff, 0x34, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xfe, 0x10, 0x78, 0x04, 0xff, 0xff, 0x78, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xfe, 0x78, 0x10, 0x04, 0x00, 0xfe, 0x01, 0x0e, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0e, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0e, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_47_image = {22, 22, sizeof(confirming_47_data), confirming_47_data};
-
-static const uint8_t confirming_48_data[247] =
-{
-    0x32, 0x00, 0xfe, 0x09, 0x59, 0x02, 0xcc, 0xfa, 0xff, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x59, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x59, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x59, 0xcc, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x59, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x59, 0x06, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x0f, 0x59, 0x05, 0xff, 0xff, 0x59, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xfd, 0xcc, 0xff, 0xcc, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_48_image = {22, 22, sizeof(confirming_48_data), confirming_48_data};
-
-static const uint8_t confirming_49_data[250] =
-{
-    0x32, 0x00, 0xff, 0x09, 0x02, 0x6a, 0xf9, 0xcc, 0xff, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x6a, 0xcc, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x6a, 0xcc, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x6a, 0xcc, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x09, 0xcc, 0x06, 0xff, 0xfe, 0x6a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xfe, 0x05, 0x6a, 0x05, 0xff, 0xfc, 0xcc, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x02, 0x10, 0xff, 0x6a, 0x03, 0xff, 0xff, 0x10, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x04, 0x10, 0xfe, 0x6a, 0xcc, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_49_image = {22, 22, sizeof(confirming_49_data), confirming_49_data};
-
-static const uint8_t confirming_50_data[250] =
-{
-    0x32, 0x00, 0xfe, 0x0a, 0x4e, 0x02, 0xca, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x4e, 0xca, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x4e, 0xca, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x4e, 0xca, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x4e, 0x06, 0xff, 0xfe, 0x4e, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x02, 0x10, 0xff, 0xca, 0x03, 0xff, 0xfc, 0xca, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x04, 0x10, 0x02, 0xff, 0xff, 0x4e, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x4e, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_50_image = {22, 22, sizeof(confirming_50_data), confirming_50_data};
-
-static const uint8_t confirming_51_data[251] =
-{
-    0x32, 0x00, 0xfe, 0x0a, 0x54, 0x02, 0xd4, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x54, 0xd4, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x54, 0xd4, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x05, 0xd4, 0x06, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfc, 0x01, 0x0b, 0x10, 0xd4, 0x04, 0xff, 0xfe, 0x54, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xff, 0x54, 0x02, 0xff, 0xfc, 0xd4, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0xfe, 0xff, 0x54, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_51_image = {22, 22, sizeof(confirming_51_data), confirming_51_data};
-
-static const uint8_t confirming_52_data[251] =
-{
-    0x32, 0x00, 0xfe, 0x0a, 0x53, 0x02, 0xba, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x53, 0xba, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x10, 0xba, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfd, 0x04, 0x0d, 0x53, 0x05, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x02, 0x10, 0xff, 0x53, 0x03, 0xff, 0xfe, 0x53, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x04, 0x10, 0xfa, 0x53, 0xff, 0xba, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x05, 0x10, 0x02, 0x53, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_52_image = {22, 22, sizeof(confirming_52_data), confirming_52_data};
-
-static const uint8_t confirming_53_data[251] =
-{
-    0x32, 0x00, 0xfe, 0x0a, 0x52, 0x02, 0xc8, 0xfa, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x52, 0xc8, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x10, 0x05, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfc, 0x04, 0x0d, 0x10, 0x52, 0x04, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0xc8, 0x02, 0xff, 0xfe, 0x52, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x05, 0x10, 0xfb, 0xff, 0xc8, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x06, 0x10, 0xff, 0x52, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_53_image = {22, 22, sizeof(confirming_53_data), confirming_53_data};
-
-static const uint8_t confirming_54_data[249] =
-{
-    0x32, 0x00, 0xff, 0x0a, 0x02, 0x6d, 0xf9, 0xe2, 0xff, 0x0f, 0x0d, 0x08, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x6d, 0x04, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfd, 0x06, 0x0d, 0x10, 0x04, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x02, 0x10, 0xff, 0x6d, 0x03, 0xff, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x04, 0x10, 0x02, 0xff, 0xfe, 0x6d, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0xe2, 0x06, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x07, 0x10, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x08, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x08, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x08, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x08, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_54_image = {22, 22, sizeof(confirming_54_data), confirming_54_data};
-
-static const uint8_t confirming_55_data[251] =
-{
-    0x32, 0x00, 0xfe, 0x01, 0x10, 0x02, 0xa3, 0xfa, 0xf7, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfd, 0x04, 0x0b, 0xa3, 0x03, 0xff, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x02, 0x10, 0x03, 0xff, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfc, 0xa3, 0xff, 0xf7, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x05, 0x10, 0xfd, 0xff, 0xa3, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0xa3, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_55_image = {22, 22, sizeof(confirming_55_data), confirming_55_data};
-
-static const uint8_t confirming_56_data[250] =
-{
-    0x32, 0x00, 0xfd, 0x01, 0x05, 0x89, 0x02, 0xfb, 0xfb, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfc, 0x04, 0x0b, 0x10, 0x89, 0x02, 0xfb, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x03, 0x10, 0x02, 0xfb, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x04, 0x10, 0x02, 0xfb, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0xfe, 0x89, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0x0d, 0x07, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x09, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_56_image = {22, 22, sizeof(confirming_56_data), confirming_56_data};
-
-static const uint8_t confirming_57_data[250] =
-{
-    0x32, 0x00, 0xfd, 0x01, 0x05, 0x09, 0x02, 0xf8, 0xfb, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x02, 0x10, 0xfe, 0x6a, 0xf8, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x04, 0x10, 0xff, 0xf8, 0x05, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x05, 0x10, 0xfe, 0xf8, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0xfe, 0x6a, 0x07, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xfc, 0x0d, 0x04, 0x00, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x05, 0x06, 0x00, 0xff, 0x05, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x05, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_57_image = {22, 22, sizeof(confirming_57_data), confirming_57_data};
-
-static const uint8_t confirming_58_data[247] =
-{
-    0x32, 0x00, 0xf6, 0x01, 0x05, 0x09, 0x0d, 0x86, 0x0f, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x03, 0x10, 0xff, 0x86, 0x04, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x04, 0x10, 0xff, 0x86, 0x05, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x06, 0x10, 0xff, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_58_image = {22, 22, sizeof(confirming_58_data), confirming_58_data};
+/* --- Confirmed Image ----------------------------------------------------- */
 
-static const uint8_t confirming_59_data[240] =
-{
-    0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x05, 0x10, 0x02, 0x0f, 0x05, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x08, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0e, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x06, 0x06, 0x00, 0xff, 0x06, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x05, 0x08, 0x03, 0xff, 0x06, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_59_image = {22, 22, sizeof(confirming_59_data), confirming_59_data};
-
-static const uint8_t confirming_60_data[236] =
-{
-    0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x06, 0x10, 0x02, 0x0c, 0x06, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x06, 0x10, 0xff, 0x0f, 0x02, 0x08, 0xff, 0x0f, 0x06, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x06, 0x10, 0xff, 0x0a, 0x02, 0x08, 0xff, 0x0a, 0x06, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x08, 0xff, 0x0d, 0x05, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xfe, 0x0f, 0x09, 0x04, 0x08, 0xfe, 0x09, 0x0f, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x04, 0x10, 0xff, 0x0b, 0x06, 0x08, 0xff, 0x0b, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x03, 0x10, 0xff, 0x0e, 0x08, 0x08, 0xff, 0x0e, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x03, 0x10, 0xff, 0x0b, 0x08, 0x0a, 0xff, 0x0b, 0x03, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_60_image = {22, 22, sizeof(confirming_60_data), confirming_60_data};
-
-static const uint8_t confirming_61_data[174] =
-{
-    0x32, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x09, 0x10, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x10, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x10, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0d, 0x10, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x09, 0x10, 0x10, 0xff, 0x09, 0x04, 0x00, 0xff, 0x05, 0x10, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x0e, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x0c, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x06, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x06, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x09, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x09, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_61_image = {22, 22, sizeof(confirming_61_data), confirming_61_data};
-
-static const uint8_t confirming_62_data[277] =
-{
-    0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x23, 0x44, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x23, 0x5c, 0x44, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x23, 0x5c, 0x60, 0x44, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x17, 0x54, 0x02, 0x60, 0xff, 0x44, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0x44, 0x03, 0x60, 0xff, 0x54, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x17, 0x23, 0x02, 0x10, 0xff, 0x31, 0x03, 0x60, 0xff, 0x31, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x23, 0x02, 0x54, 0x02, 0x10, 0xff, 0x54, 0x02, 0x60, 0xff, 0x31, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0x44, 0x03, 0x60, 0x02, 0x31, 0x02, 0x60, 0xff, 0x31, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xfd, 0x31, 0x5c, 0x60, 0x02, 0x54, 0xfe, 0x60, 0x44, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x23, 0x5c, 0x02, 0x60, 0xff, 0x54, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x23, 0x02, 0x5c, 0xff, 0x17, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x23, 0x31, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_62_image = {22, 22, sizeof(confirming_62_data), confirming_62_data};
-
-static const uint8_t confirming_63_data[277] =
-{
-    0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x36, 0x78, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x36, 0xa5, 0x78, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x36, 0xa5, 0xaf, 0x78, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x1d, 0xa5, 0x02, 0xaf, 0xff, 0x78, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0x78, 0x03, 0xaf, 0xff, 0x97, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x1d, 0x36, 0x02, 0x10, 0xff, 0x52, 0x03, 0xaf, 0xff, 0x52, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x36, 0x02, 0x97, 0x02, 0x10, 0xff, 0x97, 0x02, 0xaf, 0xff, 0x52, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0x78, 0x03, 0xaf, 0x02, 0x52, 0x02, 0xaf, 0xff, 0x52, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xff, 0x52, 0x02, 0xaf, 0x02, 0x97, 0xfe, 0xaf, 0x78, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x36, 0xa5, 0x02, 0xaf, 0xff, 0x97, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x36, 0x02, 0xa5, 0xff, 0x1d, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x36, 0x52, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
-};
-static const Image confirming_63_image = {22, 22, sizeof(confirming_63_data), confirming_63_data};
-
-static const uint8_t confirming_64_data[277] =
+/* The final frame of the confirming animation */
+static const uint8_t confirmed_data[277] =
 {
     0x32, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x0b, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x09, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x07, 0x00, 0xfe, 0x04, 0x0d, 0x09, 0x10, 0xfb, 0x4a, 0xac, 0x10, 0x0d, 0x04, 0x05, 0x00, 0xfe, 0x01, 0x0b, 0x09, 0x10, 0xfd, 0x4a, 0xf0, 0xac, 0x02, 0x10, 0xfe, 0x0b, 0x01, 0x04, 0x00, 0xff, 0x05, 0x09, 0x10, 0xfc, 0x4a, 0xf0, 0xff, 0xac, 0x03, 0x10, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x08, 0x10, 0xfe, 0x24, 0xf0, 0x02, 0xff, 0xff, 0xac, 0x03, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x0d, 0x08, 0x10, 0xff, 0xac, 0x03, 0xff, 0xff, 0xdb, 0x03, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x0f, 0x03, 0x10, 0xfe, 0x24, 0x4a, 0x02, 0x10, 0xff, 0x73, 0x03, 0xff, 0xff, 0x73, 0x04, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x0f, 0x02, 0x10, 0xff, 0x4a, 0x02, 0xdb, 0x02, 0x10, 0xff, 0xdb, 0x02, 0xff, 0xff, 0x73, 0x05, 0x10, 0xff, 0x0f, 0x04, 0x00, 0xfd, 0x0d, 0x10, 0xac, 0x03, 0xff, 0x02, 0x73, 0x02, 0xff, 0xff, 0x73, 0x06, 0x10, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x07, 0x02, 0x10, 0xff, 0x73, 0x02, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0xac, 0x07, 0x10, 0xff, 0x07, 0x04, 0x00, 0xff, 0x05, 0x03, 0x10, 0xfe, 0x4a, 0xf0, 0x02, 0xff, 0xff, 0xdb, 0x08, 0x10, 0xff, 0x05, 0x04, 0x00, 0xfe, 0x01, 0x0b, 0x03, 0x10, 0xff, 0x4a, 0x02, 0xf0, 0xff, 0x24, 0x07, 0x10, 0xfe, 0x0b, 0x01, 0x05, 0x00, 0xfe, 0x04, 0x0d, 0x03, 0x10, 0xfe, 0x4a, 0x73, 0x07, 0x10, 0xfe, 0x0d, 0x04, 0x07, 0x00, 0xfe, 0x05, 0x0d, 0x0a, 0x10, 0xfe, 0x0d, 0x05, 0x09, 0x00, 0xfe, 0x04, 0x0b, 0x08, 0x10, 0xfe, 0x0b, 0x04, 0x0b, 0x00, 0xfc, 0x01, 0x05, 0x07, 0x0d, 0x02, 0x0f, 0xfc, 0x0d, 0x07, 0x05, 0x01, 0x32, 0x00
 };
-static const Image confirming_64_image = {22, 22, sizeof(confirming_64_data), confirming_64_data};
-
-const VariantAnimation confirming = {
-    64,
-    {
-        {231, 2, 20, 100, &confirming_1_image},
-        {231, 2, 20, 100, &confirming_2_image},
-        {231, 2, 20, 100, &confirming_3_image},
-        {231, 2, 20, 100, &confirming_4_image},
-        {231, 2, 20, 100, &confirming_5_image},
-        {231, 2, 20, 100, &confirming_6_image},
-        {231, 2, 20, 100, &confirming_7_image},
-        {231, 2, 20, 100, &confirming_8_image},
-        {231, 2, 20, 100, &confirming_9_image},
-        {231, 2, 20, 100, &confirming_10_image},
-        {231, 2, 20, 100, &confirming_11_image},
-        {231, 2, 20, 100, &confirming_12_image},
-        {231, 2, 20, 100, &confirming_13_image},
-        {231, 2, 20, 100, &confirming_14_image},
-        {231, 2, 20, 100, &confirming_15_image},
-        {231, 2, 20, 100, &confirming_16_image},
-        {231, 2, 20, 100, &confirming_17_image},
-        {231, 2, 20, 100, &confirming_18_image},
-        {231, 2, 20, 100, &confirming_19_image},
-        {231, 2, 20, 100, &confirming_20_image},
-        {231, 2, 20, 100, &confirming_21_image},
-        {231, 2, 20, 100, &confirming_22_image},
-        {231, 2, 20, 100, &confirming_23_image},
-        {231, 2, 20, 100, &confirming_24_image},
-        {231, 2, 20, 100, &confirming_25_image},
-        {231, 2, 20, 100, &confirming_26_image},
-        {231, 2, 20, 100, &confirming_27_image},
-        {231, 2, 20, 100, &confirming_28_image},
-        {231, 2, 20, 100, &confirming_29_image},
-        {231, 2, 20, 100, &confirming_30_image},
-        {231, 2, 20, 100, &confirming_31_image},
-        {231, 2, 20, 100, &confirming_32_image},
-        {231, 2, 20, 100, &confirming_33_image},
-        {231, 2, 20, 100, &confirming_34_image},
-        {231, 2, 20, 100, &confirming_35_image},
-        {231, 2, 20, 100, &confirming_36_image},
-        {231, 2, 20, 100, &confirming_37_image},
-        {231, 2, 20, 100, &confirming_38_image},
-        {231, 2, 20, 100, &confirming_39_image},
-        {231, 2, 20, 100, &confirming_40_image},
-        {231, 2, 20, 100, &confirming_41_image},
-        {231, 2, 20, 100, &confirming_42_image},
-        {231, 2, 20, 100, &confirming_43_image},
-        {231, 2, 20, 100, &confirming_44_image},
-        {231, 2, 20, 100, &confirming_45_image},
-        {231, 2, 20, 100, &confirming_46_image},
-        {231, 2, 20, 100, &confirming_47_image},
-        {231, 2, 20, 100, &confirming_48_image},
-        {231, 2, 20, 100, &confirming_49_image},
-        {231, 2, 20, 100, &confirming_50_image},
-        {231, 2, 20, 100, &confirming_51_image},
-        {231, 2, 20, 100, &confirming_52_image},
-        {231, 2, 20, 100, &confirming_53_image},
-        {231, 2, 20, 100, &confirming_54_image},
-        {231, 2, 20, 100, &confirming_55_image},
-        {231, 2, 20, 100, &confirming_56_image},
-        {231, 2, 20, 100, &confirming_57_image},
-        {231, 2, 20, 100, &confirming_58_image},
-        {231, 2, 20, 100, &confirming_59_image},
-        {231, 2, 20, 100, &confirming_60_image},
-        {231, 2, 20, 100, &confirming_61_image},
-        {231, 2, 20, 100, &confirming_62_image},
-        {231, 2, 20, 100, &confirming_63_image},
-        {231, 2, 20, 100, &confirming_64_image},
-    }
-};
-
-/* --- Loading Animation --------------------------------------------------- */
-
-static const uint8_t loading_1_data[134] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x38, 0x18, 0x5d, 0x00
-};
-static const Image loading_1_image = {92, 8, sizeof(loading_1_data), loading_1_data};
-
-static const uint8_t loading_2_data[152] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x37, 0x18, 0x5d, 0x00
-};
-static const Image loading_2_image = {92, 8, sizeof(loading_2_data), loading_2_data};
+static const Image confirmed_image = {22, 22, sizeof(confirmed_data), confirmed_data};
+const AnimationFrame confirmed_frame = {231, 2, 20, 100, &confirmed_image};
 
-static const uint8_t loading_3_data[158] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x36, 0x18, 0x5d, 0x00
-};
-static const Image loading_3_image = {92, 8, sizeof(loading_3_data), loading_3_data};
-
-static const uint8_t loading_4_data[158] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x35, 0x18, 0x5d, 0x00
-};
-static const Image loading_4_image = {92, 8, sizeof(loading_4_data), loading_4_data};
-
-static const uint8_t loading_5_data[176] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x34, 0x18, 0x5d, 0x00
-};
-static const Image loading_5_image = {92, 8, sizeof(loading_5_data), loading_5_data};
-
-static const uint8_t loading_6_data[182] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x33, 0x18, 0x5d, 0x00
-};
-static const Image loading_6_image = {92, 8, sizeof(loading_6_data), loading_6_data};
-
-static const uint8_t loading_7_data[182] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x31, 0x18, 0x5d, 0x00
-};
-static const Image loading_7_image = {92, 8, sizeof(loading_7_data), loading_7_data};
-
-static const uint8_t loading_8_data[200] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x2f, 0x18, 0x5d, 0x00
-};
-static const Image loading_8_image = {92, 8, sizeof(loading_8_data), loading_8_data};
-
-static const uint8_t loading_9_data[206] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x2d, 0x18, 0x5d, 0x00
-};
-static const Image loading_9_image = {92, 8, sizeof(loading_9_data), loading_9_data};
-
-static const uint8_t loading_10_data[206] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x28, 0x18, 0x5d, 0x00
-};
-static const Image loading_10_image = {92, 8, sizeof(loading_10_data), loading_10_data};
-
-static const uint8_t loading_11_data[200] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x23, 0x18, 0x5d, 0x00
-};
-static const Image loading_11_image = {92, 8, sizeof(loading_11_data), loading_11_data};
-
-static const uint8_t loading_12_data[230] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x1a, 0x18, 0x5d, 0x00
-};
-static const Image loading_12_image = {92, 8, sizeof(loading_12_data), loading_12_data};
-
-static const uint8_t loading_13_data[230] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x11, 0x18, 0x5d, 0x00
-};
-static const Image loading_13_image = {92, 8, sizeof(loading_13_data), loading_13_data};
-
-static const uint8_t loading_14_data[230] =
-{
-    0x5d, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x02, 0x00, 0xff, 0x55, 0x05, 0xff, 0xff, 0xc2, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x0c, 0x18, 0x5d, 0x00
-};
-static const Image loading_14_image = {92, 8, sizeof(loading_14_data), loading_14_data};
-
-static const uint8_t loading_15_data[260] =
-{
-    0x5d, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x03, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x08, 0x18, 0x5d, 0x00
-};
-static const Image loading_15_image = {92, 8, sizeof(loading_15_data), loading_15_data};
-
-static const uint8_t loading_16_data[266] =
-{
-    0x5d, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x8d, 0x05, 0xff, 0xff, 0x8a, 0x04, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x06, 0x18, 0x5d, 0x00
-};
-static const Image loading_16_image = {92, 8, sizeof(loading_16_data), loading_16_data};
-
-static const uint8_t loading_17_data[242] =
-{
-    0x5d, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x9a, 0x05, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0x5d, 0x00
-};
-static const Image loading_17_image = {92, 8, sizeof(loading_17_data), loading_17_data};
-
-static const uint8_t loading_18_data[266] =
-{
-    0x5d, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x46, 0x05, 0xff, 0xff, 0xd1, 0x06, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x02, 0x18, 0x5d, 0x00
-};
-static const Image loading_18_image = {92, 8, sizeof(loading_18_data), loading_18_data};
-
-static const uint8_t loading_19_data[260] =
-{
-    0x5d, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xbb, 0x05, 0xff, 0xff, 0x5c, 0x09, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xfe, 0x52, 0x18, 0x5d, 0x00
-};
-static const Image loading_19_image = {92, 8, sizeof(loading_19_data), loading_19_data};
-
-static const uint8_t loading_20_data[230] =
-{
-    0x5d, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x08, 0x18, 0xff, 0xcf, 0x05, 0xff, 0xff, 0x48, 0x0d, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xff, 0x4c, 0x5d, 0x00
-};
-static const Image loading_20_image = {92, 8, sizeof(loading_20_data), loading_20_data};
-
-static const uint8_t loading_21_data[230] =
-{
-    0x5d, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x29, 0x05, 0xff, 0xff, 0xee, 0x13, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_21_image = {92, 8, sizeof(loading_21_data), loading_21_data};
-
-static const uint8_t loading_22_data[230] =
-{
-    0x5d, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0x52, 0x05, 0xff, 0xff, 0xc5, 0x17, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_22_image = {92, 8, sizeof(loading_22_data), loading_22_data};
-
-static const uint8_t loading_23_data[200] =
-{
-    0x5d, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x17, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_23_image = {92, 8, sizeof(loading_23_data), loading_23_data};
-
-static const uint8_t loading_24_data[206] =
-{
-    0x5d, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x1d, 0x18, 0xff, 0x59, 0x05, 0xff, 0xff, 0xbe, 0x12, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_24_image = {92, 8, sizeof(loading_24_data), loading_24_data};
-
-static const uint8_t loading_25_data[206] =
-{
-    0x5d, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x26, 0x18, 0xff, 0x37, 0x05, 0xff, 0xff, 0xe0, 0x0b, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_25_image = {92, 8, sizeof(loading_25_data), loading_25_data};
-
-static const uint8_t loading_26_data[200] =
-{
-    0x5d, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2b, 0x18, 0xff, 0x39, 0x05, 0xff, 0xff, 0xde, 0x08, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_26_image = {92, 8, sizeof(loading_26_data), loading_26_data};
-
-static const uint8_t loading_27_data[182] =
-{
-    0x5d, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2f, 0x18, 0xff, 0xd3, 0x05, 0xff, 0xff, 0x44, 0x06, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_27_image = {92, 8, sizeof(loading_27_data), loading_27_data};
-
-static const uint8_t loading_28_data[182] =
-{
-    0x5d, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0x69, 0x05, 0xff, 0xff, 0xae, 0x05, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_28_image = {92, 8, sizeof(loading_28_data), loading_28_data};
-
-static const uint8_t loading_29_data[176] =
-{
-    0x5d, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0x81, 0x05, 0xff, 0xff, 0x96, 0x04, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_29_image = {92, 8, sizeof(loading_29_data), loading_29_data};
-
-static const uint8_t loading_30_data[158] =
-{
-    0x5d, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x35, 0x18, 0xff, 0xf4, 0x05, 0xff, 0xff, 0x23, 0x03, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_30_image = {92, 8, sizeof(loading_30_data), loading_30_data};
-
-static const uint8_t loading_31_data[158] =
-{
-    0x5d, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xc5, 0x05, 0xff, 0xff, 0x52, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_31_image = {92, 8, sizeof(loading_31_data), loading_31_data};
-
-static const uint8_t loading_32_data[152] =
-{
-    0x5d, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xcb, 0x05, 0xff, 0xfe, 0x4c, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_32_image = {92, 8, sizeof(loading_32_data), loading_32_data};
-
-static const uint8_t loading_33_data[134] =
-{
-    0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_33_image = {92, 8, sizeof(loading_33_data), loading_33_data};
-
-static const uint8_t loading_34_data[134] =
-{
-    0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_34_image = {92, 8, sizeof(loading_34_data), loading_34_data};
-
-static const uint8_t loading_35_data[134] =
-{
-    0x5d, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x38, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_35_image = {92, 8, sizeof(loading_35_data), loading_35_data};
-
-static const uint8_t loading_36_data[152] =
-{
-    0x5d, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x37, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_36_image = {92, 8, sizeof(loading_36_data), loading_36_data};
-
-static const uint8_t loading_37_data[158] =
-{
-    0x5d, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x36, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_37_image = {92, 8, sizeof(loading_37_data), loading_37_data};
-
-static const uint8_t loading_38_data[158] =
-{
-    0x5d, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x34, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_38_image = {92, 8, sizeof(loading_38_data), loading_38_data};
-
-static const uint8_t loading_39_data[176] =
-{
-    0x5d, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x33, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_39_image = {92, 8, sizeof(loading_39_data), loading_39_data};
-
-static const uint8_t loading_40_data[182] =
-{
-    0x5d, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x31, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_40_image = {92, 8, sizeof(loading_40_data), loading_40_data};
-
-static const uint8_t loading_41_data[182] =
-{
-    0x5d, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x2e, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_41_image = {92, 8, sizeof(loading_41_data), loading_41_data};
-
-static const uint8_t loading_42_data[200] =
-{
-    0x5d, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x29, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_42_image = {92, 8, sizeof(loading_42_data), loading_42_data};
-
-static const uint8_t loading_43_data[206] =
-{
-    0x5d, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x21, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_43_image = {92, 8, sizeof(loading_43_data), loading_43_data};
-
-static const uint8_t loading_44_data[206] =
-{
-    0x5d, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x00, 0x19, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_44_image = {92, 8, sizeof(loading_44_data), loading_44_data};
-
-static const uint8_t loading_45_data[200] =
-{
-    0x5d, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x02, 0x00, 0x15, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xfe, 0x43, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_45_image = {92, 8, sizeof(loading_45_data), loading_45_data};
-
-static const uint8_t loading_46_data[230] =
-{
-    0x5d, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0f, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xff, 0x3f, 0x02, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_46_image = {92, 8, sizeof(loading_46_data), loading_46_data};
-
-static const uint8_t loading_47_data[230] =
-{
-    0x5d, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x02, 0x00, 0x0a, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x04, 0x18, 0x06, 0xff, 0x5d, 0x00
-};
-static const Image loading_47_image = {92, 8, sizeof(loading_47_data), loading_47_data};
-
-static const uint8_t loading_48_data[230] =
-{
-    0x5d, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x02, 0x00, 0x07, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0xff, 0xd4, 0x05, 0xff, 0xff, 0x43, 0x5d, 0x00
-};
-static const Image loading_48_image = {92, 8, sizeof(loading_48_data), loading_48_data};
-
-static const uint8_t loading_49_data[260] =
-{
-    0x5d, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x02, 0x00, 0x06, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x05, 0x18, 0xff, 0xd8, 0x05, 0xff, 0xfe, 0x3f, 0x18, 0x5d, 0x00
-};
-static const Image loading_49_image = {92, 8, sizeof(loading_49_data), loading_49_data};
-
-static const uint8_t loading_50_data[266] =
-{
-    0x5d, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x02, 0x00, 0x04, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x06, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x03, 0x18, 0x5d, 0x00
-};
-static const Image loading_50_image = {92, 8, sizeof(loading_50_data), loading_50_data};
-
-static const uint8_t loading_51_data[242] =
-{
-    0x5d, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x02, 0x00, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0a, 0x18, 0xff, 0xc0, 0x05, 0xff, 0xff, 0x57, 0x04, 0x18, 0x5d, 0x00
-};
-static const Image loading_51_image = {92, 8, sizeof(loading_51_data), loading_51_data};
-
-static const uint8_t loading_52_data[266] =
-{
-    0x5d, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x02, 0x00, 0x02, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x10, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x06, 0x18, 0x5d, 0x00
-};
-static const Image loading_52_image = {92, 8, sizeof(loading_52_data), loading_52_data};
-
-static const uint8_t loading_53_data[260] =
-{
-    0x5d, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x02, 0x00, 0xfe, 0x18, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x15, 0x18, 0xff, 0xe7, 0x05, 0xff, 0xff, 0x30, 0x09, 0x18, 0x5d, 0x00
-};
-static const Image loading_53_image = {92, 8, sizeof(loading_53_data), loading_53_data};
-
-static const uint8_t loading_54_data[230] =
-{
-    0x5d, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x02, 0x00, 0xff, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x15, 0x18, 0xff, 0xac, 0x05, 0xff, 0xff, 0x6b, 0x0e, 0x18, 0x5d, 0x00
-};
-static const Image loading_54_image = {92, 8, sizeof(loading_54_data), loading_54_data};
-
-static const uint8_t loading_55_data[230] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x02, 0x00, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x12, 0x18, 0xff, 0xec, 0x05, 0xff, 0xff, 0x2b, 0x16, 0x18, 0x5d, 0x00
-};
-static const Image loading_55_image = {92, 8, sizeof(loading_55_data), loading_55_data};
-
-static const uint8_t loading_56_data[230] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x02, 0x00, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x0f, 0x18, 0xff, 0xce, 0x05, 0xff, 0xff, 0x49, 0x1e, 0x18, 0x5d, 0x00
-};
-static const Image loading_56_image = {92, 8, sizeof(loading_56_data), loading_56_data};
-
-static const uint8_t loading_57_data[200] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x02, 0x00, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x0e, 0x18, 0x06, 0xff, 0x23, 0x18, 0x5d, 0x00
-};
-static const Image loading_57_image = {92, 8, sizeof(loading_57_data), loading_57_data};
-
-static const uint8_t loading_58_data[206] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x09, 0x18, 0xff, 0xab, 0x05, 0xff, 0xff, 0x6c, 0x28, 0x18, 0x5d, 0x00
-};
-static const Image loading_58_image = {92, 8, sizeof(loading_58_data), loading_58_data};
-
-static const uint8_t loading_59_data[206] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x06, 0x18, 0xff, 0x95, 0x05, 0xff, 0xff, 0x82, 0x2d, 0x18, 0x5d, 0x00
-};
-static const Image loading_59_image = {92, 8, sizeof(loading_59_data), loading_59_data};
-
-static const uint8_t loading_60_data[200] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x04, 0x18, 0xff, 0x30, 0x05, 0xff, 0xff, 0xe7, 0x30, 0x18, 0x5d, 0x00
-};
-static const Image loading_60_image = {92, 8, sizeof(loading_60_data), loading_60_data};
-
-static const uint8_t loading_61_data[182] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x04, 0x18, 0xff, 0xe3, 0x05, 0xff, 0xff, 0x34, 0x31, 0x18, 0x5d, 0x00
-};
-static const Image loading_61_image = {92, 8, sizeof(loading_61_data), loading_61_data};
-
-static const uint8_t loading_62_data[182] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x03, 0x18, 0xff, 0x57, 0x05, 0xff, 0xff, 0xc0, 0x33, 0x18, 0x5d, 0x00
-};
-static const Image loading_62_image = {92, 8, sizeof(loading_62_data), loading_62_data};
-
-static const uint8_t loading_63_data[176] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x03, 0x18, 0xff, 0x7f, 0x05, 0xff, 0xff, 0x98, 0x34, 0x18, 0x5d, 0x00
-};
-static const Image loading_63_image = {92, 8, sizeof(loading_63_data), loading_63_data};
-
-static const uint8_t loading_64_data[158] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x03, 0x18, 0xff, 0x86, 0x05, 0xff, 0xff, 0x91, 0x35, 0x18, 0x5d, 0x00
-};
-static const Image loading_64_image = {92, 8, sizeof(loading_64_data), loading_64_data};
-
-static const uint8_t loading_65_data[158] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0x02, 0x18, 0xff, 0x73, 0x05, 0xff, 0xff, 0xa4, 0x36, 0x18, 0x5d, 0x00
-};
-static const Image loading_65_image = {92, 8, sizeof(loading_65_data), loading_65_data};
-
-static const uint8_t loading_66_data[152] =
-{
-    0x5d, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x02, 0x00, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xff, 0x18, 0x06, 0xff, 0xfe, 0x18, 0x4e, 0x05, 0xff, 0xff, 0xc9, 0x37, 0x18, 0x5d, 0x00
-};
-static const Image loading_66_image = {92, 8, sizeof(loading_66_data), loading_66_data};
-
-const VariantAnimation loading = {
-    66,
-    {
-        {83, 29, 40, 100, &loading_1_image},
-        {83, 29, 40, 100, &loading_2_image},
-        {83, 29, 40, 100, &loading_3_image},
-        {83, 29, 40, 100, &loading_4_image},
-        {83, 29, 40, 100, &loading_5_image},
-        {83, 29, 40, 100, &loading_6_image},
-        {83, 29, 40, 100, &loading_7_image},
-        {83, 29, 40, 100, &loading_8_image},
-        {83, 29, 40, 100, &loading_9_image},
-        {83, 29, 40, 100, &loading_10_image},
-        {83, 29, 40, 100, &loading_11_image},
-        {83, 29, 40, 100, &loading_12_image},
-        {83, 29, 40, 100, &loading_13_image},
-        {83, 29, 40, 100, &loading_14_image},
-        {83, 29, 40, 100, &loading_15_image},
-        {83, 29, 40, 100, &loading_16_image},
-        {83, 29, 40, 100, &loading_17_image},
-        {83, 29, 40, 100, &loading_18_image},
-        {83, 29, 40, 100, &loading_19_image},
-        {83, 29, 40, 100, &loading_20_image},
-        {83, 29, 40, 100, &loading_21_image},
-        {83, 29, 40, 100, &loading_22_image},
-        {83, 29, 40, 100, &loading_23_image},
-        {83, 29, 40, 100, &loading_24_image},
-        {83, 29, 40, 100, &loading_25_image},
-        {83, 29, 40, 100, &loading_26_image},
-        {83, 29, 40, 100, &loading_27_image},
-        {83, 29, 40, 100, &loading_28_image},
-        {83, 29, 40, 100, &loading_29_image},
-        {83, 29, 40, 100, &loading_30_image},
-        {83, 29, 40, 100, &loading_31_image},
-        {83, 29, 40, 100, &loading_32_image},
-        {83, 29, 40, 100, &loading_33_image},
-        {83, 29, 40, 100, &loading_34_image},
-        {83, 29, 40, 100, &loading_35_image},
-        {83, 29, 40, 100, &loading_36_image},
-        {83, 29, 40, 100, &loading_37_image},
-        {83, 29, 40, 100, &loading_38_image},
-        {83, 29, 40, 100, &loading_39_image},
-        {83, 29, 40, 100, &loading_40_image},
-        {83, 29, 40, 100, &loading_41_image},
-        {83, 29, 40, 100, &loading_42_image},
-        {83, 29, 40, 100, &loading_43_image},
-        {83, 29, 40, 100, &loading_44_image},
-        {83, 29, 40, 100, &loading_45_image},
-        {83, 29, 40, 100, &loading_46_image},
-        {83, 29, 40, 100, &loading_47_image},
-        {83, 29, 40, 100, &loading_48_image},
-        {83, 29, 40, 100, &loading_49_image},
-        {83, 29, 40, 100, &loading_50_image},
-        {83, 29, 40, 100, &loading_51_image},
-        {83, 29, 40, 100, &loading_52_image},
-        {83, 29, 40, 100, &loading_53_image},
-        {83, 29, 40, 100, &loading_54_image},
-        {83, 29, 40, 100, &loading_55_image},
-        {83, 29, 40, 100, &loading_56_image},
-        {83, 29, 40, 100, &loading_57_image},
-        {83, 29, 40, 100, &loading_58_image},
-        {83, 29, 40, 100, &loading_59_image},
-        {83, 29, 40, 100, &loading_60_image},
-        {83, 29, 40, 100, &loading_61_image},
-        {83, 29, 40, 100, &loading_62_image},
-        {83, 29, 40, 100, &loading_63_image},
-        {83, 29, 40, 100, &loading_64_image},
-        {83, 29, 40, 100, &loading_65_image},
-        {83, 29, 40, 100, &loading_66_image},
-    }
-};
+/* --- Confirming and Loading Animations ----------------------------------- */
 
+/* Frame deltas, encoded from animations.txt at build time */
+#include "animation_data.inc"
 
 /* --- Warning Animation --------------------------------------------------- */
 
@@ -1039,8 +128,7 @@ const AnimationFrame *get_confirm_icon_frame(void)
  */
 const AnimationFrame *get_confirmed_frame(void)
 {
-    // the confirmed image is the final frame of the confirming animation
-    return &confirming.frames[confirming.count-1];
+    return &confirmed_frame;
 }
 
 /*
@@ -1090,7 +178,7 @@ const AnimationFrame *get_warning_frame(void)
  * OUTPUT
  *     confirming animation
  */
-const VariantAnimation *get_confirming_animation(void)
+const DeltaAnimation *get_confirming_animation(void)
 {
     return &confirming;
 }
@@ -1103,7 +191,7 @@ const VariantAnimation *get_confirming_animation(void)
  * OUTPUT
  *     loading animation
  */
-const VariantAnimation *get_loading_animation(void)
+const DeltaAnimation *get_loading_animation(void)
 {
     return &loading;
 }
@@ -1172,3 +260,46 @@ int get_image_animation_frame(const VariantAnimation *animation,
     return -1;
 }
 
+/*
+ * get_delta_animation_duration() - Calculate delta animation duration
+ *
+ * INPUT
+ *     - animation: delta animation
+ * OUTPUT
+ *    animation duration
+ */
+uint32_t get_delta_animation_duration(const DeltaAnimation *animation)
+{
+    return (uint32_t)animation->duration * animation->count;
+}
+
+/*
+ * get_delta_animation_frame() - Get a delta animation frame
+ *
+ * INPUT
+ *     - animation: animation to pull frame from
+ *     - elapsed: how long has animation elapsed
+ *     - loop: is this animation looping?
+ * OUTPUT
+ *    number of the frame that should be displayed
+ */
+int get_delta_animation_frame(const DeltaAnimation *animation,
+                              const uint32_t elapsed, bool loop)
+{
+    uint32_t adjusted_elapsed = (loop)
+        ? elapsed % get_delta_animation_duration(animation)
+        : elapsed;
+
+    if(adjusted_elapsed == 0)
+    {
+        return 0;
+    }
+
+    /* Frames are shown until the end of their duration, inclusive */
+    if((adjusted_elapsed - 1) / animation->duration >= animation->count)
+    {
+        return -1;
+    }
+
+    return (adjusted_elapsed - 1) / animation->duration;
+}
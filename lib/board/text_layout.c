@@ -0,0 +1,194 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/board/text_layout.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* === Private Variables =================================================== */
+
+static TextLayout layout_cache[ TEXT_LAYOUT_CACHE_SIZE ];
+static char layout_cache_str[ TEXT_LAYOUT_CACHE_SIZE ][ TEXT_LAYOUT_MAX_STRING ];
+static uint8_t layout_cache_next = 0;
+
+/* Layout of the last string too long to cache */
+static TextLayout layout_uncached;
+
+/* === Private Functions =================================================== */
+
+/*
+ * text_new_line() - Start a line at the given offset
+ *
+ * INPUT
+ *     - layout: layout being built
+ *     - offset: index of the first character of the line
+ * OUTPUT
+ *     the new line, or NULL once the table is full
+ */
+static TextLine *text_new_line(TextLayout *layout, uint16_t offset)
+{
+    TextLine *line = NULL;
+
+    if(layout->count < TEXT_LAYOUT_MAX_LINES)
+    {
+        line = &layout->lines[ layout->count ];
+        line->offset = offset;
+        line->length = 0;
+        line->width = 0;
+    }
+
+    layout->count++;
+    return line;
+}
+
+/*
+ * text_break_lines() - Fill in the line table for a string
+ *
+ *     A line breaks at '\n', before a space whose following word would not
+ *     fit, and before any other character that would not fit.  Spaces at the
+ *     start of a line are dropped.  Each word is measured once, from the
+ *     space in front of it.
+ *
+ * INPUT
+ *     - layout: layout with its key filled in
+ *     - str: string
+ * OUTPUT
+ *     none
+ */
+static void text_break_lines(TextLayout *layout, const char *str)
+{
+    const Font *font = layout->font;
+    uint16_t x_offset = 0;
+    uint16_t i;
+    TextLine *line;
+
+    layout->count = 0;
+    line = text_new_line(layout, 0);
+
+    for(i = 0; i < layout->str_length; i++)
+    {
+        uint16_t character_width;
+        uint16_t word_width;
+
+        if(str[i] == '\n')
+        {
+            line = text_new_line(layout, i + 1);
+            x_offset = 0;
+            continue;
+        }
+
+        character_width = font_get_char(font, str[i])->width;
+        word_width = character_width;
+
+        if(str[i] == ' ')
+        {
+            uint16_t j;
+
+            for(j = i + 1; j < layout->str_length && str[j] != ' ' && str[j] != '\n'; j++)
+            {
+                word_width += font_get_char(font, str[j])->width;
+            }
+        }
+
+        if(layout->line_width != 0 && x_offset + word_width > layout->line_width)
+        {
+            line = text_new_line(layout, i);
+            x_offset = 0;
+        }
+
+        if(x_offset == 0 && str[i] == ' ')
+        {
+            if(line != NULL)
+            {
+                line->offset = i + 1;
+            }
+
+            continue;
+        }
+
+        x_offset += character_width;
+
+        if(line != NULL)
+        {
+            line->length = i + 1 - line->offset;
+            line->width = x_offset;
+        }
+    }
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * text_layout() - Get the line breaks of a string
+ *
+ *     The last few layouts are kept, with a copy of each string, so
+ *     measuring a string and then drawing it, or drawing the same screen
+ *     again, breaks the lines only once.
+ *
+ * INPUT
+ *     - font: font the string is drawn in
+ *     - str: string
+ *     - line_width: maximum line width, or 0 to break only at '\n'
+ * OUTPUT
+ *     line table, valid until the next call
+ */
+const TextLayout *text_layout(const Font *font, const char *str, uint16_t line_width)
+{
+    TextLayout *layout;
+    size_t length = strlen(str);
+    int i;
+
+    if(length > TEXT_LAYOUT_MAX_STRING)
+    {
+        layout = &layout_uncached;
+        layout->font = font;
+        layout->line_width = line_width;
+        layout->str_length = length;
+        text_break_lines(layout, str);
+
+        return layout;
+    }
+
+    /* The key includes the whole string, so a hit is always the same text */
+    for(i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        layout = &layout_cache[ i ];
+
+        if(layout->font == font && layout->line_width == line_width &&
+                layout->str_length == length &&
+                memcmp(layout_cache_str[ i ], str, length) == 0)
+        {
+            return layout;
+        }
+    }
+
+    layout = &layout_cache[ layout_cache_next ];
+    memcpy(layout_cache_str[ layout_cache_next ], str, length);
+    layout_cache_next = (layout_cache_next + 1) % TEXT_LAYOUT_CACHE_SIZE;
+
+    layout->font = font;
+    layout->line_width = line_width;
+    layout->str_length = length;
+    text_break_lines(layout, str);
+
+    return layout;
+}
@@ -24,6 +24,8 @@
 #  include <libopencm3/stm32/f2/nvic.h>
 #  include <libopencm3/stm32/rcc.h>
 #  include <libopencm3/cm3/cortex.h>
+#else
+#  include <time.h>
 #endif
 
 #include "keepkey/board/keepkey_leds.h"
@@ -34,6 +36,7 @@
 /* === Private Variables =================================================== */
 
 static volatile uint32_t remaining_delay = UINT32_MAX;
+static volatile uint32_t clock_ms = 0;
 static RunnableNode runnables[MAX_RUNNABLES];
 static RunnableQueue free_queue = {NULL, 0};
 static RunnableQueue active_queue = {NULL, 0};
@@ -312,6 +315,25 @@ void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
     }
 }
 
+/*
+ * get_clock_ms() - Milliseconds since the timer started, wrapping at 2^32
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     millisecond count
+ */
+uint32_t get_clock_ms(void)
+{
+#ifndef EMULATOR
+    return clock_ms;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+#endif
+}
+
 #ifndef EMULATOR
 /*
  * tim4_isr() - Timer 4 interrupt service routine
@@ -324,6 +346,8 @@ void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
  */
 void tim4_isr(void)
 {
+    clock_ms++;
+
     /* Decrement the delay */
     if(remaining_delay > 0)
     {
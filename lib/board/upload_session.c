@@ -0,0 +1,232 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/board/memory.h"
+#include "keepkey/board/upload_session.h"
+
+#include <string.h>
+
+/* === Functions =========================================================== */
+
+/*
+ * upload_session_start() - Start a chunked upload, or pick up the one in
+ * progress if it is for the same image
+ *
+ * INPUT
+ *     - session: upload state
+ *     - hash: SHA256 of the image as memory_firmware_hash() computes it
+ *     - length: image length, meta header included
+ *     - max_length: space available for the image
+ * OUTPUT
+ *     true/false whether the upload can proceed; session->offset is where
+ *     the host should continue from
+ */
+bool upload_session_start(UploadSession *session, const uint8_t *hash,
+                          uint32_t length, uint32_t max_length)
+{
+    if(session->active && session->length == length &&
+            memcmp(session->expected_hash, hash, SHA256_DIGEST_LENGTH) == 0)
+    {
+        return(true);
+    }
+
+    upload_session_clear(session);
+
+    if(length < FLASH_META_DESC_LEN || length > max_length)
+    {
+        return(false);
+    }
+
+    session->active = true;
+    memcpy(session->expected_hash, hash, SHA256_DIGEST_LENGTH);
+    session->length = length;
+    session->hash_limit = length;
+    sha256_Init(&session->ctx);
+
+    return(true);
+}
+
+/*
+ * upload_session_rebuild() - Account for the part of the image that an
+ * upload interrupted by a reset already programmed, so that it resumes
+ * rather than starting over.  The magic is only programmed once the image
+ * verifies, so an unfinished image still has it erased.  The last
+ * programmed word may have been cut short, so it is sent again.
+ *
+ * INPUT
+ *     - session: upload state, just started
+ *     - flash: start of the image area in flash
+ * OUTPUT
+ *     none; session->offset is where the host should continue from
+ */
+void upload_session_rebuild(UploadSession *session, const uint8_t *flash)
+{
+    static const uint8_t erased[sizeof(uint32_t)] = { 0xff, 0xff, 0xff, 0xff };
+    uint8_t header[META_MAGIC_SIZE + sizeof(uint32_t)];
+    uint32_t end = META_MAGIC_SIZE;
+
+    if(!session->active || session->offset != 0 ||
+            memcmp(flash, erased, META_MAGIC_SIZE) != 0)
+    {
+        return;
+    }
+
+    while(end + sizeof(uint32_t) <= session->length &&
+            memcmp(flash + end, erased, sizeof(uint32_t)) != 0)
+    {
+        end += sizeof(uint32_t);
+    }
+
+    end -= sizeof(uint32_t);
+
+    if(end < sizeof(header))
+    {
+        return;
+    }
+
+    /* The code length must come with the magic, in the first chunk */
+    memcpy(header, META_MAGIC_STR, META_MAGIC_SIZE);
+    memcpy(header + META_MAGIC_SIZE, flash + META_MAGIC_SIZE, sizeof(uint32_t));
+    upload_session_chunk(session, 0, header, sizeof(header));
+
+    while(session->offset < end)
+    {
+        uint32_t len = end - session->offset;
+        len = len < UPLOAD_CHUNK_SIZE ? len : UPLOAD_CHUNK_SIZE;
+
+        if(upload_session_chunk(session, session->offset, flash + session->offset,
+                                len) != UPLOAD_CHUNK_NEW)
+        {
+            break;
+        }
+    }
+}
+
+/*
+ * upload_session_chunk() - Account for and hash a chunk of the image
+ *
+ * INPUT
+ *     - session: upload state
+ *     - offset: position of the chunk in the image
+ *     - data: chunk contents
+ *     - len: chunk length
+ * OUTPUT
+ *     whether the chunk is new, a repeat of one already accepted, or invalid
+ */
+UploadChunkStatus upload_session_chunk(UploadSession *session, uint32_t offset,
+                                       const uint8_t *data, uint32_t len)
+{
+    if(!session->active || len == 0 || len > UPLOAD_CHUNK_SIZE)
+    {
+        return(UPLOAD_CHUNK_INVALID);
+    }
+
+    /* A host that lost our acknowledgement sends the last chunk again */
+    if(offset < session->offset && len <= session->offset - offset)
+    {
+        return(UPLOAD_CHUNK_REPEAT);
+    }
+
+    if(offset != session->offset || len > session->length - offset)
+    {
+        return(UPLOAD_CHUNK_INVALID);
+    }
+
+    if(offset == 0)
+    {
+        const app_meta_td *meta = (const app_meta_td *)data;
+
+        /* The code length must come with the magic, in the first chunk */
+        if(len < sizeof(meta->magic) + sizeof(meta->code_len) ||
+                memcmp(data, META_MAGIC_STR, META_MAGIC_SIZE) != 0)
+        {
+            return(UPLOAD_CHUNK_INVALID);
+        }
+
+        uint32_t code_len;
+        memcpy(&code_len, data + sizeof(meta->magic), sizeof(code_len));
+
+        if(code_len <= session->length - FLASH_META_DESC_LEN)
+        {
+            session->hash_limit = FLASH_META_DESC_LEN + code_len;
+        }
+    }
+
+    if(offset < session->hash_limit)
+    {
+        uint32_t n = session->hash_limit - offset;
+        sha256_Update(&session->ctx, data, len < n ? len : n);
+    }
+
+    session->offset += len;
+
+    return(UPLOAD_CHUNK_NEW);
+}
+
+/*
+ * upload_session_done() - Whether every chunk of the image has arrived
+ *
+ * INPUT
+ *     - session: upload state
+ * OUTPUT
+ *     true/false
+ */
+bool upload_session_done(const UploadSession *session)
+{
+    return(session->active && session->offset == session->length);
+}
+
+/*
+ * upload_session_verify() - Compare the hash of the uploaded image with the
+ * one the host announced.  Ends the session.
+ *
+ * INPUT
+ *     - session: upload state
+ * OUTPUT
+ *     true/false whether the image is complete and matches
+ */
+bool upload_session_verify(UploadSession *session)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    bool ret_val = false;
+
+    if(upload_session_done(session))
+    {
+        sha256_Final(&session->ctx, digest);
+        ret_val = memcmp(digest, session->expected_hash, SHA256_DIGEST_LENGTH) == 0;
+    }
+
+    upload_session_clear(session);
+    return(ret_val);
+}
+
+/*
+ * upload_session_clear() - Forget any upload in progress
+ *
+ * INPUT
+ *     - session: upload state
+ * OUTPUT
+ *     none
+ */
+void upload_session_clear(UploadSession *session)
+{
+    memset(session, 0, sizeof(*session));
+}
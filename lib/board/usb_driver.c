@@ -24,6 +24,9 @@
 #  include <libopencm3/stm32/desig.h>
 #  include <libopencm3/usb/hid.h>
 #  include <libopencm3/stm32/rcc.h>
+#else
+#  include "keepkey/board/emulator_socket.h"
+#  include <stdio.h>
 #endif
 
 #include "keepkey/board/keepkey_board.h"
@@ -48,6 +51,22 @@ static usbd_device *usbd_dev = NULL;
  */
 static bool usb_configured = false;
 
+/* Packets queued for each IN endpoint */
+typedef struct
+{
+    uint8_t packets[USB_TX_QUEUE_DEPTH][USB_SEGMENT_SIZE];
+    uint8_t endpoint;
+    uint16_t head;
+    uint16_t count;
+    UsbTxStats stats;
+} UsbTxQueue;
+
+static UsbTxQueue tx_queue = { .endpoint = ENDPOINT_ADDRESS_IN };
+
+#if DEBUG_LINK
+static UsbTxQueue tx_debug_queue = { .endpoint = ENDPOINT_ADDRESS_DEBUG_IN };
+#endif
+
 /* USB device descriptor */
 static const struct usb_device_descriptor dev_descr = {
 	.bLength = USB_DT_DEVICE_SIZE,
@@ -734,6 +753,101 @@ static void hid_debug_rx_callback(usbd_device *dev, uint8_t ep)
 }
 #endif
 
+/*
+ * usb_tx_kick() - Hand queued packets to an IN endpoint until it is busy
+ *
+ * INPUT
+ *     - q: transmit queue
+ * OUTPUT
+ *     none
+ */
+static void usb_tx_kick(UsbTxQueue *q)
+{
+    while(q->count > 0)
+    {
+        if(usbd_ep_write_packet(usbd_dev, q->endpoint, q->packets[q->head],
+                                USB_SEGMENT_SIZE) == 0)
+        {
+            break;
+        }
+
+        q->head = (q->head + 1) % USB_TX_QUEUE_DEPTH;
+        q->count--;
+        q->stats.packets++;
+    }
+}
+
+/*
+ * usb_tx_enqueue() - Queue a packet for an IN endpoint.  Only waits when the
+ * ring is full, and then only for the endpoint to take the oldest packet.
+ *
+ * INPUT
+ *     - q: transmit queue
+ *     - packet: USB_SEGMENT_SIZE bytes to send
+ * OUTPUT
+ *     none
+ */
+static void usb_tx_enqueue(UsbTxQueue *q, const uint8_t *packet)
+{
+    if(q->count == USB_TX_QUEUE_DEPTH)
+    {
+        q->stats.stalls++;
+
+        while(q->count == USB_TX_QUEUE_DEPTH)
+        {
+            usb_tx_kick(q);
+        }
+    }
+
+    memcpy(q->packets[(q->head + q->count) % USB_TX_QUEUE_DEPTH], packet,
+           USB_SEGMENT_SIZE);
+    q->count++;
+
+    if(q->count > q->stats.max_depth)
+    {
+        q->stats.max_depth = q->count;
+    }
+
+    usb_tx_kick(q);
+}
+
+/*
+ * hid_tx_callback() - Callback function run when an IN packet has been sent
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - ep: unused
+ * OUTPUT
+ *     none
+ */
+static void hid_tx_callback(usbd_device *dev, uint8_t ep)
+{
+    (void)dev;
+    (void)ep;
+
+    usb_tx_kick(&tx_queue);
+}
+
+#if DEBUG_LINK
+/*
+ * hid_debug_tx_callback() - Callback function run when an IN packet has been
+ * sent on debug endpoint
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - ep: unused
+ * OUTPUT
+ *     none
+ */
+static void hid_debug_tx_callback(usbd_device *dev, uint8_t ep)
+{
+    (void)dev;
+    (void)ep;
+
+    usb_tx_kick(&tx_debug_queue);
+}
+#endif
+
 /*
  * hid_set_config_callback() - Config USB IN/OUT endpoints and register callbacks
  *
@@ -747,10 +861,10 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
 {
 	(void)wValue;
 
-	usbd_ep_setup(dev, ENDPOINT_ADDRESS_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, 0);
+	usbd_ep_setup(dev, ENDPOINT_ADDRESS_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, hid_tx_callback);
 	usbd_ep_setup(dev, ENDPOINT_ADDRESS_OUT, USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, hid_rx_callback);
 #if DEBUG_LINK
-	usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, 0);
+	usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, hid_debug_tx_callback);
 	usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_OUT, USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, hid_debug_rx_callback);
 #endif
 
@@ -764,7 +878,9 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
 }
 
 /*
- * usb_tx_helper() - Common way to transmit USB message to host 
+ * usb_tx_helper() - Common way to transmit USB message to host.  Packets are
+ * queued and sent as the endpoint completes earlier ones, so this only blocks
+ * while the queue is full.
  *
  * INPUT
  *     - message: pointer message buffer
@@ -775,8 +891,18 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
  */
 static bool usb_tx_helper(uint8_t *message, uint32_t len, uint8_t endpoint)
 {
+    UsbTxQueue *q = &tx_queue;
     uint32_t pos = 1;
 
+#if DEBUG_LINK
+    if(endpoint == ENDPOINT_ADDRESS_DEBUG_IN)
+    {
+        q = &tx_debug_queue;
+    }
+#else
+    (void)endpoint;
+#endif
+
     /* Chunk out message */
     while(pos < len)
     {
@@ -785,7 +911,7 @@ static bool usb_tx_helper(uint8_t *message, uint32_t len, uint8_t endpoint)
         tmp_buffer[0] = '?';
         memcpy(tmp_buffer + 1, message + pos, USB_SEGMENT_SIZE - 1);
 
-        while(usbd_ep_write_packet(usbd_dev, endpoint, tmp_buffer, USB_SEGMENT_SIZE) == 0) {};
+        usb_tx_enqueue(q, tmp_buffer);
 
         pos += USB_SEGMENT_SIZE - 1;
     }
@@ -844,6 +970,231 @@ bool usb_init(void)
 void usb_poll(void)
 {
     usbd_poll(usbd_dev);
+
+    usb_tx_kick(&tx_queue);
+#if DEBUG_LINK
+    usb_tx_kick(&tx_debug_queue);
+#endif
+}
+
+/*
+ * usb_flush() - Wait until every queued packet has been handed to the USB
+ * peripheral
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void usb_flush(void)
+{
+    if(!usb_configured)
+    {
+        return;
+    }
+
+    while(tx_queue.count > 0)
+    {
+        usb_tx_kick(&tx_queue);
+    }
+
+#if DEBUG_LINK
+    while(tx_debug_queue.count > 0)
+    {
+        usb_tx_kick(&tx_debug_queue);
+    }
+#endif
+}
+
+/*
+ * usb_tx_stats() - Get transmit queue counters for the normal endpoint
+ *
+ * INPUT
+ *     - stats: destination for the counters
+ * OUTPUT
+ *     none
+ */
+void usb_tx_stats(UsbTxStats *stats)
+{
+    *stats = tx_queue.stats;
+    stats->depth = tx_queue.count;
+}
+
+/*
+ * usb_tx() - Transmit USB message to host via normal endpoint
+ *
+ * INPUT
+ *     - message: pointer message buffer
+ *     - len: length of message
+ * OUTPUT
+ *     true/false
+ */
+bool usb_tx(uint8_t *message, uint32_t len)
+{
+    return usb_tx_helper(message, len, ENDPOINT_ADDRESS_IN);
+}
+
+#else /* EMULATOR */
+
+/* === Private Variables =================================================== */
+
+/* Reports received on the normal endpoint are appended here as hex lines */
+static FILE *record_file = NULL;
+
+/* === Variables =========================================================== */
+
+usb_rx_callback_t user_rx_callback = NULL;
+
+#if DEBUG_LINK
+usb_rx_callback_t user_debug_rx_callback = NULL;
+#endif
+
+/* === Private Functions =================================================== */
+
+/*
+ * emulator_rx() - Hand the next pending report on a socket to its receive
+ * callback.  Like usbd_poll(), one report is delivered per poll so that a
+ * callback polling for the next fragment of a message sees them in order
+ *
+ * INPUT
+ *     - sock: emulator socket number
+ *     - callback: receive callback
+ * OUTPUT
+ *     none
+ */
+static void emulator_rx(int sock, usb_rx_callback_t callback)
+{
+    UsbMessage m;
+
+    if((m.len = emulator_socket_recv(sock, m.message, USB_SEGMENT_SIZE)) > 0)
+    {
+        if(record_file && sock == EMULATOR_SOCKET_NORMAL)
+        {
+            for(uint32_t i = 0; i < m.len; i++)
+            {
+                fprintf(record_file, "%02x", m.message[i]);
+            }
+
+            fputc('\n', record_file);
+            fflush(record_file);
+        }
+
+        if(callback)
+        {
+            callback(&m);
+        }
+    }
+}
+
+/*
+ * usb_tx_helper() - Common way to transmit USB message to host
+ *
+ * INPUT
+ *     - message: pointer message buffer
+ *     - len: length of message
+ *     - endpoint: endpoint for transmission
+ * OUTPUT
+ *     true/false
+ */
+static bool usb_tx_helper(uint8_t *message, uint32_t len, uint8_t endpoint)
+{
+    int sock = EMULATOR_SOCKET_NORMAL;
+    uint32_t pos = 1;
+
+#if DEBUG_LINK
+    if(endpoint == ENDPOINT_ADDRESS_DEBUG_IN)
+    {
+        sock = EMULATOR_SOCKET_DEBUG;
+    }
+#else
+    (void)endpoint;
+#endif
+
+    /* Chunk out message */
+    while(pos < len)
+    {
+        uint8_t tmp_buffer[USB_SEGMENT_SIZE] = { 0 };
+
+        tmp_buffer[0] = '?';
+        memcpy(tmp_buffer + 1, message + pos, USB_SEGMENT_SIZE - 1);
+
+        if(!emulator_socket_send(sock, tmp_buffer, USB_SEGMENT_SIZE))
+        {
+            return(false);
+        }
+
+        pos += USB_SEGMENT_SIZE - 1;
+    }
+
+    return(true);
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * usb_init() - Open the emulator's localhost sockets
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false status of USB init
+ */
+bool usb_init(void)
+{
+    bool ret_stat = emulator_socket_open(EMULATOR_SOCKET_NORMAL, EMULATOR_UDP_PORT);
+
+#if DEBUG_LINK
+    ret_stat = emulator_socket_open(EMULATOR_SOCKET_DEBUG, EMULATOR_UDP_PORT + 1) && ret_stat;
+#endif
+
+    return(ret_stat);
+}
+
+/*
+ * usb_poll() - Wait up to a millisecond for a report and dispatch it
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void usb_poll(void)
+{
+    if(!emulator_socket_wait(1))
+    {
+        return;
+    }
+
+    emulator_rx(EMULATOR_SOCKET_NORMAL, user_rx_callback);
+#if DEBUG_LINK
+    emulator_rx(EMULATOR_SOCKET_DEBUG, user_debug_rx_callback);
+#endif
+}
+
+/*
+ * usb_flush() - Reports are sent as they are written, so there is nothing
+ * to wait for
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void usb_flush(void)
+{
+}
+
+/*
+ * usb_tx_stats() - Get transmit queue counters for the normal endpoint
+ *
+ * INPUT
+ *     - stats: destination for the counters
+ * OUTPUT
+ *     none
+ */
+void usb_tx_stats(UsbTxStats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
 }
 
 /*
@@ -859,6 +1210,26 @@ bool usb_tx(uint8_t *message, uint32_t len)
 {
     return usb_tx_helper(message, len, ENDPOINT_ADDRESS_IN);
 }
+
+/*
+ * usb_record() - Append every report received on the normal endpoint to a
+ * file, one hex encoded report per line, for replay with kkreplay
+ *
+ * INPUT
+ *     - path: file to append to
+ * OUTPUT
+ *     true/false whether the file could be opened
+ */
+bool usb_record(const char *path)
+{
+    if(record_file)
+    {
+        fclose(record_file);
+    }
+
+    record_file = fopen(path, "a");
+    return(record_file != NULL);
+}
 #endif
 
 /*
@@ -873,9 +1244,11 @@ bool usb_tx(uint8_t *message, uint32_t len)
 #if DEBUG_LINK || defined(EMULATOR)
 bool usb_debug_tx(uint8_t *message, uint32_t len)
 {
-#ifndef EMULATOR
+#if DEBUG_LINK
     return usb_tx_helper(message, len, ENDPOINT_ADDRESS_DEBUG_IN);
 #else
+    (void)message;
+    (void)len;
     return false;
 #endif
 }
@@ -891,9 +1264,7 @@ bool usb_debug_tx(uint8_t *message, uint32_t len)
  */
 void usb_set_rx_callback(usb_rx_callback_t callback)
 {
-#ifndef EMULATOR
     user_rx_callback = callback;
-#endif
 }
 
 /*
@@ -907,8 +1278,10 @@ void usb_set_rx_callback(usb_rx_callback_t callback)
 #if DEBUG_LINK || defined(EMULATOR)
 void usb_set_debug_rx_callback(usb_rx_callback_t callback)
 {
-#ifndef EMULATOR
+#if DEBUG_LINK
     user_debug_rx_callback = callback;
+#else
+    (void)callback;
 #endif
 }
 #endif
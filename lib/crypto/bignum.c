@@ -465,10 +465,18 @@ void bn_multiply_reduce(bignum256 *x, uint32_t res[18], const bignum256 *prime)
 // result is partly reduced (0 <= x < 2 * prime)
 // This only works for primes between 2^256-2^224 and 2^256.
 void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime)
+{
+	bn_multiply_with(k, x, prime, bn_multiply_reduce);
+}
+
+// Compute x := k * x  (mod prime) like bn_multiply, but reduce the
+// product with the given kernel, e.g. one specialized for the form of
+// prime (see ecdsa_curve.multiply_reduce).
+void bn_multiply_with(const bignum256 *k, bignum256 *x, const bignum256 *prime, bn_reduce_func reduce)
 {
 	uint32_t res[18] = {0};
 	bn_multiply_long(k, x, res);
-	bn_multiply_reduce(x, res, prime); 
+	reduce(x, res, prime);
 	MEMSET_BZERO(res, sizeof(res));
 }
 
@@ -266,6 +266,95 @@ int hdnode_public_ckd(HDNode *inout, uint32_t i)
 	return 1;
 }
 
+// Like calling hdnode_public_ckd(&inout[j], i[j]) for j = 0..count-1,
+// but the child points are normalized in batches with a single field
+// inversion each.  The nodes may have different parents, e.g. the
+// cosigner xpubs of a multisig path.  Returns 0 if any derivation
+// failed; the nodes are then left in an unspecified state.
+int hdnode_public_ckd_batch(HDNode *inout, const uint32_t *i, size_t count)
+{
+	uint8_t data[1 + 32 + 4];
+	uint8_t I[32 + 32];
+	uint8_t chain_code[ECDSA_BATCH_SIZE][32];
+	bool fallback[ECDSA_BATCH_SIZE];
+	curve_point pub[ECDSA_BATCH_SIZE], child[ECDSA_BATCH_SIZE];
+	bignum256 c[ECDSA_BATCH_SIZE];
+	const ecdsa_curve *params;
+	size_t base, j, n;
+	int ret = 1;
+
+	for (base = 0; base < count && ret; base += n) {
+		n = count - base < ECDSA_BATCH_SIZE ? count - base : ECDSA_BATCH_SIZE;
+		params = inout[base].curve->params;
+		if (!params) {
+			return 0;
+		}
+		for (j = 0; j < n; j++) {
+			HDNode *node = &inout[base + j];
+			// rare cases take the sequential path: another curve, an
+			// invalid I_L, or (below) a child at infinity
+			fallback[j] = node->curve->params != params;
+			bn_zero(&c[j]);
+			pub[j] = params->G;
+			if (fallback[j]) {
+				continue;
+			}
+			if (i[base + j] & 0x80000000) { // private derivation
+				ret = 0;
+				break;
+			}
+			// siblings share the parent point, which is costly to read
+			if (j > 0 && !fallback[j - 1] && memcmp(node->public_key, inout[base + j - 1].public_key, 33) == 0) {
+				pub[j] = pub[j - 1];
+			} else if (!ecdsa_read_pubkey(params, node->public_key, &pub[j])) {
+				ret = 0;
+				break;
+			}
+			memcpy(data, node->public_key, 33);
+			write_be(data + 33, i[base + j]);
+			hmac_sha512(node->chain_code, 32, data, sizeof(data), I);
+			bn_read_be(I, &c[j]);
+			memcpy(chain_code[j], I + 32, 32);
+			if (!bn_is_less(&c[j], &params->order)) { // >= order
+				fallback[j] = true;
+				bn_zero(&c[j]);
+			}
+		}
+		if (!ret) {
+			break;
+		}
+
+		scalar_multiply_add_batch(params, c, pub, child, n);
+
+		for (j = 0; j < n; j++) {
+			HDNode *node = &inout[base + j];
+			if (fallback[j] || point_is_infinity(&child[j])) {
+				if (!hdnode_public_ckd(node, i[base + j])) {
+					ret = 0;
+					break;
+				}
+				continue;
+			}
+			memset(node->private_key, 0, 32);
+			node->public_key[0] = 0x02 | (child[j].y.val[0] & 0x01);
+			bn_write_be(&child[j].x, node->public_key + 1);
+			memcpy(node->chain_code, chain_code[j], 32);
+			node->depth++;
+			node->child_num = i[base + j];
+		}
+	}
+
+	// Wipe all stack data.
+	MEMSET_BZERO(data, sizeof(data));
+	MEMSET_BZERO(I, sizeof(I));
+	MEMSET_BZERO(chain_code, sizeof(chain_code));
+	MEMSET_BZERO(pub, sizeof(pub));
+	MEMSET_BZERO(child, sizeof(child));
+	MEMSET_BZERO(c, sizeof(c));
+
+	return ret;
+}
+
 int hdnode_public_ckd_address_optimized(const curve_point *pub, const uint8_t *public_key, const uint8_t *chain_code, uint32_t i, uint8_t version, char *addr, int addrsize)
 {
 	uint8_t data[1 + 32 + 4];
@@ -307,16 +396,91 @@ int hdnode_public_ckd_address_optimized(const curve_point *pub, const uint8_t *p
 
 #if USE_BIP32_CACHE
 
-static bool private_ckd_cache_root_set = false;
-static HDNode private_ckd_cache_root;
-static int private_ckd_cache_index = 0;
-
-static struct {
+/*
+ * The cache is a forest of derived nodes. Each root entry holds a root node
+ * and every other entry holds the child reached from its parent entry by one
+ * index, so a path shared by several accounts (m/44'/0', m/44'/60', ...) is
+ * stored once and any cached prefix of a requested path is reused.
+ * Only leaves are evicted, which keeps every cached path reachable.
+ */
+typedef struct {
 	bool set;
-	size_t depth;
-	uint32_t i[BIP32_CACHE_MAXDEPTH];
+	int16_t parent;    // entry index of the parent, -1 for a root
+	uint16_t children; // number of entries whose parent is this one
+	uint32_t i;        // child index from the parent, unused for a root
+	uint32_t used;     // LRU stamp
 	HDNode node;
-} private_ckd_cache[BIP32_CACHE_SIZE];
+} private_ckd_cache_entry;
+
+#define BIP32_CACHE_SIZE (BIP32_CACHE_BUDGET / sizeof(private_ckd_cache_entry))
+
+static private_ckd_cache_entry private_ckd_cache[BIP32_CACHE_SIZE];
+static uint32_t private_ckd_cache_clock = 0;
+static uint32_t private_ckd_cache_hits = 0;
+static uint32_t private_ckd_cache_misses = 0;
+
+static int private_ckd_cache_find_root(const HDNode *root)
+{
+	size_t j;
+	for (j = 0; j < BIP32_CACHE_SIZE; j++) {
+		if (private_ckd_cache[j].set && private_ckd_cache[j].parent < 0 &&
+		    memcmp(&private_ckd_cache[j].node, root, sizeof(HDNode)) == 0) {
+			return j;
+		}
+	}
+	return -1;
+}
+
+static int private_ckd_cache_find(int parent, uint32_t i)
+{
+	size_t j;
+	for (j = 0; j < BIP32_CACHE_SIZE; j++) {
+		if (private_ckd_cache[j].set && private_ckd_cache[j].parent == parent &&
+		    private_ckd_cache[j].i == i) {
+			return j;
+		}
+	}
+	return -1;
+}
+
+// returns a free entry, evicting the least recently used leaf if needed;
+// entries touched by the current lookup are never evicted
+static int private_ckd_cache_alloc(void)
+{
+	int victim = -1;
+	size_t j;
+	for (j = 0; j < BIP32_CACHE_SIZE; j++) {
+		const private_ckd_cache_entry *e = &private_ckd_cache[j];
+		if (!e->set) return j;
+		if (e->children == 0 && e->used != private_ckd_cache_clock &&
+		    (victim < 0 || e->used < private_ckd_cache[victim].used)) {
+			victim = j;
+		}
+	}
+	if (victim >= 0) {
+		if (private_ckd_cache[victim].parent >= 0) {
+			private_ckd_cache[private_ckd_cache[victim].parent].children--;
+		}
+		MEMSET_BZERO(&private_ckd_cache[victim], sizeof(private_ckd_cache[victim]));
+	}
+	return victim;
+}
+
+static int private_ckd_cache_insert(int parent, uint32_t i, const HDNode *node)
+{
+	int j = private_ckd_cache_alloc();
+	if (j < 0) return -1;
+	private_ckd_cache[j].set = true;
+	private_ckd_cache[j].parent = parent;
+	private_ckd_cache[j].children = 0;
+	private_ckd_cache[j].i = i;
+	private_ckd_cache[j].used = private_ckd_cache_clock;
+	memcpy(&private_ckd_cache[j].node, node, sizeof(HDNode));
+	if (parent >= 0) {
+		private_ckd_cache[parent].children++;
+	}
+	return j;
+}
 
 int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count)
 {
@@ -328,43 +492,38 @@ int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count)
 		return 1;
 	}
 
-	bool found = false;
-	// if root is not set or not the same
-	if (!private_ckd_cache_root_set || memcmp(&private_ckd_cache_root, inout, sizeof(HDNode)) != 0) {
-		// clear the cache
-		private_ckd_cache_index = 0;
-		memset(private_ckd_cache, 0, sizeof(private_ckd_cache));
-		// setup new root
-		memcpy(&private_ckd_cache_root, inout, sizeof(HDNode));
-		private_ckd_cache_root_set = true;
+	private_ckd_cache_clock++;
+
+	// walk down the longest cached prefix of the parent path
+	int entry = private_ckd_cache_find_root(inout);
+	if (entry < 0) {
+		entry = private_ckd_cache_insert(-1, 0, inout);
+	}
+	size_t k = 0;
+	while (entry >= 0) {
+		private_ckd_cache[entry].used = private_ckd_cache_clock;
+		if (k == i_count - 1) break;
+		int next = private_ckd_cache_find(entry, i[k]);
+		if (next < 0) break;
+		entry = next;
+		k++;
+	}
+
+	if (k == i_count - 1) {
+		private_ckd_cache_hits++;
 	} else {
-		// try to find parent
-		int j;
-		for (j = 0; j < BIP32_CACHE_SIZE; j++) {
-			if (private_ckd_cache[j].set &&
-			    private_ckd_cache[j].depth == i_count - 1 &&
-			    memcmp(private_ckd_cache[j].i, i, (i_count - 1) * sizeof(uint32_t)) == 0 &&
-				private_ckd_cache[j].node.curve == inout->curve) {
-				memcpy(inout, &(private_ckd_cache[j].node), sizeof(HDNode));
-				found = true;
-				break;
-			}
-		}
+		private_ckd_cache_misses++;
+	}
+	if (entry >= 0 && k > 0) {
+		memcpy(inout, &private_ckd_cache[entry].node, sizeof(HDNode));
 	}
 
-	// else derive parent
-	if (!found) {
-		size_t k;
-		for (k = 0; k < i_count - 1; k++) {
-			if (hdnode_private_ckd(inout, i[k]) == 0) return 0;
+	// derive and save the rest of the parent path
+	for (; k < i_count - 1; k++) {
+		if (hdnode_private_ckd(inout, i[k]) == 0) return 0;
+		if (entry >= 0) {
+			entry = private_ckd_cache_insert(entry, i[k], inout);
 		}
-		// and save it
-		memset(&(private_ckd_cache[private_ckd_cache_index]), 0, sizeof(private_ckd_cache[private_ckd_cache_index]));
-		private_ckd_cache[private_ckd_cache_index].set = true;
-		private_ckd_cache[private_ckd_cache_index].depth = i_count - 1;
-		memcpy(private_ckd_cache[private_ckd_cache_index].i, i, (i_count - 1) * sizeof(uint32_t));
-		memcpy(&(private_ckd_cache[private_ckd_cache_index].node), inout, sizeof(HDNode));
-		private_ckd_cache_index = (private_ckd_cache_index + 1) % BIP32_CACHE_SIZE;
 	}
 
 	if (hdnode_private_ckd(inout, i[i_count - 1]) == 0) return 0;
@@ -372,6 +531,20 @@ int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count)
 	return 1;
 }
 
+void hdnode_private_ckd_cache_clear(void)
+{
+	MEMSET_BZERO(private_ckd_cache, sizeof(private_ckd_cache));
+	private_ckd_cache_clock = 0;
+	private_ckd_cache_hits = 0;
+	private_ckd_cache_misses = 0;
+}
+
+void hdnode_private_ckd_cache_stats(uint32_t *hits, uint32_t *misses)
+{
+	*hits = private_ckd_cache_hits;
+	*misses = private_ckd_cache_misses;
+}
+
 #endif
 
 void hdnode_get_address_raw(HDNode *node, uint32_t version, uint8_t *addr_raw)
@@ -38,6 +38,12 @@
 #include <string.h>
 #include <assert.h>
 
+// x := k * x (mod curve->prime) with the curve's reduction kernel
+static inline void field_multiply(const ecdsa_curve *curve, const bignum256 *k, bignum256 *x)
+{
+	bn_multiply_with(k, x, &curve->prime, curve->multiply_reduce);
+}
+
 // Set cp2 = cp1
 void point_copy(const curve_point *cp1, curve_point *cp2)
 {
@@ -68,11 +74,11 @@ void point_add(const ecdsa_curve *curve, const curve_point *cp1, curve_point *cp
 	bn_subtractmod(&(cp2->x), &(cp1->x), &inv, &curve->prime);
 	bn_inverse(&inv, &curve->prime);
 	bn_subtractmod(&(cp2->y), &(cp1->y), &lambda, &curve->prime);
-	bn_multiply(&inv, &lambda, &curve->prime);
+	field_multiply(curve, &inv, &lambda);
 
 	// xr = lambda^2 - x1 - x2
 	xr = lambda;
-	bn_multiply(&xr, &xr, &curve->prime);
+	field_multiply(curve, &xr, &xr);
 	yr = cp1->x;
 	bn_addmod(&yr, &(cp2->x), &curve->prime);
 	bn_subtractmod(&xr, &yr, &xr, &curve->prime);
@@ -81,7 +87,7 @@ void point_add(const ecdsa_curve *curve, const curve_point *cp1, curve_point *cp
 
 	// yr = lambda (x1 - xr) - y1
 	bn_subtractmod(&(cp1->x), &xr, &yr, &curve->prime);
-	bn_multiply(&lambda, &yr, &curve->prime);
+	field_multiply(curve, &lambda, &yr);
 	bn_subtractmod(&yr, &(cp1->y), &yr, &curve->prime);
 	bn_fast_mod(&yr, &curve->prime);
 	bn_mod(&yr, &curve->prime);
@@ -109,14 +115,14 @@ void point_double(const ecdsa_curve *curve, curve_point *cp)
 	bn_inverse(&lambda, &curve->prime);
 
 	xr = cp->x;
-	bn_multiply(&xr, &xr, &curve->prime);
+	field_multiply(curve, &xr, &xr);
 	bn_mult_k(&xr, 3, &curve->prime);
 	bn_subi(&xr, -curve->a, &curve->prime);
-	bn_multiply(&xr, &lambda, &curve->prime);
+	field_multiply(curve, &xr, &lambda);
 
 	// xr = lambda^2 - 2*x
 	xr = lambda;
-	bn_multiply(&xr, &xr, &curve->prime);
+	field_multiply(curve, &xr, &xr);
 	yr = cp->x;
 	bn_lshift(&yr);
 	bn_subtractmod(&xr, &yr, &xr, &curve->prime);
@@ -125,7 +131,7 @@ void point_double(const ecdsa_curve *curve, curve_point *cp)
 
 	// yr = lambda (x - xr) - y
 	bn_subtractmod(&(cp->x), &xr, &yr, &curve->prime);
-	bn_multiply(&lambda, &yr, &curve->prime);
+	field_multiply(curve, &lambda, &yr);
 	bn_subtractmod(&yr, &(cp->y), &yr, &curve->prime);
 	bn_fast_mod(&yr, &curve->prime);
 	bn_mod(&yr, &curve->prime);
@@ -188,11 +194,7 @@ void conditional_negate(uint32_t cond, bignum256 *a, const bignum256 *prime)
 	assert(a->val[8] < 0x20000);
 }
 
-typedef struct jacobian_curve_point {
-	bignum256 x, y, z;
-} jacobian_curve_point;
-
-void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp, const bignum256 *prime) {
+void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp, const ecdsa_curve *curve) {
 	int i;
 	// randomize z coordinate
 	for (i = 0; i < 8; i++) {
@@ -201,33 +203,83 @@ void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp, const big
 	jp->z.val[8] = (random32() & 0x7fff) + 1;
 
 	jp->x = jp->z;
-	bn_multiply(&jp->z, &jp->x, prime);
+	field_multiply(curve, &jp->z, &jp->x);
 	// x = z^2
 	jp->y = jp->x;
-	bn_multiply(&jp->z, &jp->y, prime);
+	field_multiply(curve, &jp->z, &jp->y);
 	// y = z^3
 
-	bn_multiply(&p->x, &jp->x, prime);
-	bn_multiply(&p->y, &jp->y, prime);
+	field_multiply(curve, &p->x, &jp->x);
+	field_multiply(curve, &p->y, &jp->y);
 }
 
-void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p, const bignum256 *prime) {
+void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p, const ecdsa_curve *curve) {
+	const bignum256 *prime = &curve->prime;
 	p->y = jp->z;
 	bn_inverse(&p->y, prime);
 	// p->y = z^-1
 	p->x = p->y;
-	bn_multiply(&p->x, &p->x, prime);
+	field_multiply(curve, &p->x, &p->x);
 	// p->x = z^-2
-	bn_multiply(&p->x, &p->y, prime);
+	field_multiply(curve, &p->x, &p->y);
 	// p->y = z^-3
-	bn_multiply(&jp->x, &p->x, prime);
+	field_multiply(curve, &jp->x, &p->x);
 	// p->x = jp->x * z^-2
-	bn_multiply(&jp->y, &p->y, prime);
+	field_multiply(curve, &jp->y, &p->y);
 	// p->y = jp->y * z^-3
 	bn_mod(&p->x, prime);
 	bn_mod(&p->y, prime);
 }
 
+// Convert n jacobian points to affine coordinates with a single field
+// inversion (Montgomery's trick): 1 inversion and 3(n-1) multiplications
+// for the inverses, instead of n inversions.
+// jp and p must not overlap, n must be positive and no point may be at
+// infinity (z = 0).
+void jacobian_to_curve_batch(const jacobian_curve_point *jp, curve_point *p, int n, const ecdsa_curve *curve) {
+	const bignum256 *prime = &curve->prime;
+	bignum256 inv, zinv, zinv2;
+	int i;
+
+	// p[i].y = z_0 * ... * z_i
+	p[0].y = jp[0].z;
+	for (i = 1; i < n; i++) {
+		p[i].y = p[i - 1].y;
+		field_multiply(curve, &jp[i].z, &p[i].y);
+	}
+
+	inv = p[n - 1].y;
+	bn_inverse(&inv, prime);
+	// inv = (z_0 * ... * z_i)^-1, starting with i = n - 1
+
+	for (i = n - 1; i >= 0; i--) {
+		if (i > 0) {
+			zinv = p[i - 1].y;
+			field_multiply(curve, &inv, &zinv);
+			// zinv = z_i^-1
+			field_multiply(curve, &jp[i].z, &inv);
+			// inv = (z_0 * ... * z_{i-1})^-1
+		} else {
+			zinv = inv;
+		}
+		zinv2 = zinv;
+		field_multiply(curve, &zinv2, &zinv2);
+		p[i].x = jp[i].x;
+		field_multiply(curve, &zinv2, &p[i].x);
+		// p->x = jp->x * z^-2
+		field_multiply(curve, &zinv2, &zinv);
+		p[i].y = jp[i].y;
+		field_multiply(curve, &zinv, &p[i].y);
+		// p->y = jp->y * z^-3
+		bn_mod(&p[i].x, prime);
+		bn_mod(&p[i].y, prime);
+	}
+
+	MEMSET_BZERO(&inv, sizeof(inv));
+	MEMSET_BZERO(&zinv, sizeof(zinv));
+	MEMSET_BZERO(&zinv2, sizeof(zinv2));
+}
+
 void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const ecdsa_curve *curve) {
 	bignum256 r, h, r2;
 	bignum256 hcby, hsqx;
@@ -271,17 +323,17 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const e
 	 */
 
 	xz = p2->z;
-	bn_multiply(&xz, &xz, prime); // xz = z2^2
+	field_multiply(curve, &xz, &xz); // xz = z2^2
 	yz = p2->z;
-	bn_multiply(&xz, &yz, prime); // yz = z2^3
+	field_multiply(curve, &xz, &yz); // yz = z2^3
 	
 	if (a != 0) {
 		az  = xz;
-		bn_multiply(&az, &az, prime);   // az = z2^4
+		field_multiply(curve, &az, &az);   // az = z2^4
 		bn_mult_k(&az, -a, prime);      // az = -az2^4
 	}
 	
-	bn_multiply(&p1->x, &xz, prime);        // xz = x1' = x1*z2^2;
+	field_multiply(curve, &p1->x, &xz);        // xz = x1' = x1*z2^2;
 	h = xz;
 	bn_subtractmod(&h, &p2->x, &h, prime);
 	bn_fast_mod(&h, prime);
@@ -296,7 +348,7 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const e
 	// bn_fast_mod.
 	is_doubling = bn_is_equal(&h, prime);
 
-	bn_multiply(&p1->y, &yz, prime);        // yz = y1' = y1*z2^3;
+	field_multiply(curve, &p1->y, &yz);        // yz = y1' = y1*z2^3;
 	bn_subtractmod(&yz, &p2->y, &r, prime);
 	// r = y1' - y2;
 
@@ -304,7 +356,7 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const e
 	// yz = y1' + y2
 
 	r2 = p2->x;
-	bn_multiply(&r2, &r2, prime);
+	field_multiply(curve, &r2, &r2);
 	bn_mult_k(&r2, 3, prime);
 	
 	if (a != 0) {
@@ -317,31 +369,31 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const e
 
 	// hsqx = h^2
 	hsqx = h;
-	bn_multiply(&hsqx, &hsqx, prime);
+	field_multiply(curve, &hsqx, &hsqx);
 
 	// hcby = h^3
 	hcby = h;
-	bn_multiply(&hsqx, &hcby, prime);
+	field_multiply(curve, &hsqx, &hcby);
 
 	// hsqx = h^2 * (x1 + x2)
-	bn_multiply(&xz, &hsqx, prime);
+	field_multiply(curve, &xz, &hsqx);
 
 	// hcby = h^3 * (y1 + y2)
-	bn_multiply(&yz, &hcby, prime);
+	field_multiply(curve, &yz, &hcby);
 
 	// z3 = h*z2
-	bn_multiply(&h, &p2->z, prime);
+	field_multiply(curve, &h, &p2->z);
 
 	// x3 = r^2 - h^2 (x1 + x2)
 	p2->x = r;
-	bn_multiply(&p2->x, &p2->x, prime);
+	field_multiply(curve, &p2->x, &p2->x);
 	bn_subtractmod(&p2->x, &hsqx, &p2->x, prime);
 	bn_fast_mod(&p2->x, prime);
 
 	// y3 = 1/2 (r*(h^2 (x1 + x2) - 2x3) - h^3 (y1 + y2))
 	bn_subtractmod(&hsqx, &p2->x, &p2->y, prime);
 	bn_subtractmod(&p2->y, &p2->x, &p2->y, prime);
-	bn_multiply(&r, &p2->y, prime);
+	field_multiply(curve, &r, &p2->y);
 	bn_subtractmod(&p2->y, &hcby, &p2->y, prime);
 	bn_mult_half(&p2->y, prime);
 	bn_fast_mod(&p2->y, prime);
@@ -376,29 +428,44 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
 	 * z3 = y*z
 	 */
 
-	m = p->x;
-	bn_multiply(&m, &m, prime);
-	bn_mult_k(&m, 3, prime);
-
-	az4 = p->z;
-	bn_multiply(&az4, &az4, prime);
-	bn_multiply(&az4, &az4, prime);
-	bn_mult_k(&az4, -curve->a, prime);
-	bn_subtractmod(&m, &az4, &m, prime);
+	if (curve->a == 0) {
+		// m = 3*x^2 / 2
+		m = p->x;
+		field_multiply(curve, &m, &m);
+		bn_mult_k(&m, 3, prime);
+	} else if (curve->a == -3) {
+		// 3*x^2 - 3*z^4 = 3*(x - z^2)*(x + z^2)
+		az4 = p->z;
+		field_multiply(curve, &az4, &az4);
+		bn_subtractmod(&p->x, &az4, &m, prime);
+		bn_add(&az4, &p->x);
+		field_multiply(curve, &az4, &m);
+		bn_mult_k(&m, 3, prime);
+	} else {
+		m = p->x;
+		field_multiply(curve, &m, &m);
+		bn_mult_k(&m, 3, prime);
+
+		az4 = p->z;
+		field_multiply(curve, &az4, &az4);
+		field_multiply(curve, &az4, &az4);
+		bn_mult_k(&az4, -curve->a, prime);
+		bn_subtractmod(&m, &az4, &m, prime);
+	}
 	bn_mult_half(&m, prime);
 
 	// msq = m^2
 	msq = m;
-	bn_multiply(&msq, &msq, prime);
+	field_multiply(curve, &msq, &msq);
 	// ysq = y^2
 	ysq = p->y;
-	bn_multiply(&ysq, &ysq, prime);
+	field_multiply(curve, &ysq, &ysq);
 	// xysq = xy^2
 	xysq = p->x;
-	bn_multiply(&ysq, &xysq, prime);
+	field_multiply(curve, &ysq, &xysq);
 
 	// z3 = yz
-	bn_multiply(&p->y, &p->z, prime);
+	field_multiply(curve, &p->y, &p->z);
 
 	// x3 = m^2 - 2*xy^2
 	p->x = xysq;
@@ -409,12 +476,41 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
 
 	// y3 = m*(xy^2 - x3) - y^4
 	bn_subtractmod(&xysq, &p->x, &p->y, prime);
-	bn_multiply(&m, &p->y, prime);
-	bn_multiply(&ysq, &ysq, prime);
+	field_multiply(curve, &m, &p->y);
+	field_multiply(curve, &ysq, &ysq);
 	bn_subtractmod(&p->y, &ysq, &p->y, prime);
 	bn_fast_mod(&p->y, prime);
 }
 
+// pmult[i] = (2*i+1) * p for i = 0..7.
+// The odd multiples are built in jacobian coordinates by repeatedly
+// adding 2*p, and then normalized together, so the table costs two
+// field inversions instead of eight.
+static void point_odd_multiples(const ecdsa_curve *curve, const curve_point *p, curve_point *pmult)
+{
+	int i;
+	jacobian_curve_point jmult[7];
+
+	pmult[0] = *p;
+	jmult[0].x = p->x;
+	jmult[0].y = p->y;
+	bn_zero(&jmult[0].z);
+	jmult[0].z.val[0] = 1;
+	point_jacobian_double(&jmult[0], curve);
+	// store 2*p temporarily in pmult[7]
+	jacobian_to_curve(&jmult[0], &pmult[7], curve);
+	jmult[0].x = p->x;
+	jmult[0].y = p->y;
+	bn_zero(&jmult[0].z);
+	jmult[0].z.val[0] = 1;
+	point_jacobian_add(&pmult[7], &jmult[0], curve);
+	for (i = 1; i < 7; i++) {
+		jmult[i] = jmult[i-1];
+		point_jacobian_add(&pmult[7], &jmult[i], curve);
+	}
+	jacobian_to_curve_batch(jmult, &pmult[1], 7, curve);
+}
+
 // res = k * p
 void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_point *p, curve_point *res)
 {
@@ -470,16 +566,7 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 	//
 	// We compute |a[i]| * p in advance for all possible
 	// values of |a[i]| * p.  pmult[i] = (2*i+1) * p
-	// We compute p, 3*p, ..., 15*p and store it in the table pmult.
-	// store p^2 temporarily in pmult[7]
-	pmult[7] = *p;
-	point_double(curve, &pmult[7]);
-	// compute 3*p, etc by repeatedly adding p^2.
-	pmult[0] = *p;
-	for (i = 1; i < 8; i++) {
-		pmult[i] = pmult[7];
-		point_add(curve, &pmult[i-1], &pmult[i]);
-	}
+	point_odd_multiples(curve, p, pmult);
 
 	// now compute  res = sum_{i=0..63} a[i] * 16^i * p step by step,
 	// starting with i = 63.
@@ -496,7 +583,7 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 	sign = (bits >> 4) - 1;
 	bits ^= sign;
 	bits &= 15;
-	curve_to_jacobian(&pmult[bits>>1], &jres, prime);
+	curve_to_jacobian(&pmult[bits>>1], &jres, curve);
 	for (i = 62; i >= 0; i--) {
 		// sign = sign(a[i+1])  (0xffffffff for negative, 0 for positive)
 		// invariant jres = (-1)^sign sum_{j=i+1..63} (a[j] * 16^{j-i-1} * p)
@@ -533,14 +620,15 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 		sign = nsign;
 	}
 	conditional_negate(sign, &jres.z, prime);
-	jacobian_to_curve(&jres, res, prime);
+	jacobian_to_curve(&jres, res, curve);
 }
 
 #if USE_PRECOMPUTED_CP
 
-// res = k * G
+// jres = k * G in jacobian coordinates
 // k must be a normalized number with 0 <= k < curve->order
-void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *res)
+// returns 0 if k is zero, i.e., the result is the point at infinity
+static int scalar_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k, jacobian_curve_point *jres)
 {
 	assert (bn_is_less(k, &curve->order));
 
@@ -548,7 +636,6 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 	bignum256 a;
 	uint32_t is_even = (k->val[0] & 1) - 1;
 	uint32_t lowbits;
-	jacobian_curve_point jres;
 	const bignum256 *prime = &curve->prime;
 
 	// is_even = 0xffffffff if k is even, 0 otherwise.
@@ -569,8 +656,7 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 
 	// special case 0*G:  just return zero. We don't care about constant time.
 	if (!is_non_zero) {
-		point_set_infinity(res);
-		return;
+		return 0;
 	}
 
 	// Now a = k + 2^256 (mod curve->order) and a is odd.
@@ -596,7 +682,7 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 	lowbits = a.val[0] & ((1 << 5) - 1);
 	lowbits ^= (lowbits >> 4) - 1;
 	lowbits &= 15;
-	curve_to_jacobian(&curve->cp[0][lowbits >> 1], &jres, prime);
+	curve_to_jacobian(&curve->cp[0][lowbits >> 1], jres, curve);
 	for (i = 1; i < 64; i ++) {
 		// invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 16^j * G)
 
@@ -613,13 +699,25 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 		lowbits &= 15;
 		// negate last result to make signs of this round and the
 		// last round equal.
-		conditional_negate((lowbits & 1) - 1, &jres.y, prime);
+		conditional_negate((lowbits & 1) - 1, &jres->y, prime);
 
 		// add odd factor
-		point_jacobian_add(&curve->cp[i][lowbits >> 1], &jres, curve);
+		point_jacobian_add(&curve->cp[i][lowbits >> 1], jres, curve);
 	}
-	conditional_negate(((a.val[0] >> 4) & 1) - 1, &jres.y, prime);
-	jacobian_to_curve(&jres, res, prime);
+	conditional_negate(((a.val[0] >> 4) & 1) - 1, &jres->y, prime);
+	return 1;
+}
+
+// res = k * G
+// k must be a normalized number with 0 <= k < curve->order
+void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *res)
+{
+	jacobian_curve_point jres;
+	if (!scalar_multiply_jacobian(curve, k, &jres)) {
+		point_set_infinity(res);
+		return;
+	}
+	jacobian_to_curve(&jres, res, curve);
 }
 
 #else
@@ -631,6 +729,190 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 
 #endif
 
+// res[i] = k[i] * G + p[i] for i = 0..n-1
+// k[i] must be normalized numbers with 0 <= k[i] < curve->order.
+// The sums are kept in jacobian coordinates and normalized
+// ECDSA_BATCH_SIZE at a time with jacobian_to_curve_batch, so each
+// batch costs one field inversion instead of two per point.
+// Not constant time; meant for public derivation, where k[i] and p[i]
+// are public.
+void scalar_multiply_add_batch(const ecdsa_curve *curve, const bignum256 *k, const curve_point *p, curve_point *res, int n)
+{
+#if USE_PRECOMPUTED_CP
+	jacobian_curve_point jp[ECDSA_BATCH_SIZE];
+	curve_point batch[ECDSA_BATCH_SIZE];
+	int idx[ECDSA_BATCH_SIZE];
+	bignum256 z;
+	int base, i, m;
+
+	for (base = 0; base < n; base += ECDSA_BATCH_SIZE) {
+		m = 0;
+		for (i = base; i < n && i < base + ECDSA_BATCH_SIZE; i++) {
+			if (point_is_infinity(&p[i])) {
+				scalar_multiply(curve, &k[i], &res[i]);
+				continue;
+			}
+			if (!scalar_multiply_jacobian(curve, &k[i], &jp[m])) {
+				res[i] = p[i];
+				continue;
+			}
+			point_jacobian_add(&p[i], &jp[m], curve);
+			// k[i] * G = -p[i] leaves z = 0 (mod prime)
+			z = jp[m].z;
+			bn_mod(&z, &curve->prime);
+			if (bn_is_zero(&z)) {
+				point_set_infinity(&res[i]);
+				continue;
+			}
+			idx[m++] = i;
+		}
+		if (m == 0) {
+			continue;
+		}
+		jacobian_to_curve_batch(jp, batch, m, curve);
+		for (i = 0; i < m; i++) {
+			res[idx[i]] = batch[i];
+		}
+	}
+
+	MEMSET_BZERO(jp, sizeof(jp));
+	MEMSET_BZERO(batch, sizeof(batch));
+#else
+	int i;
+	for (i = 0; i < n; i++) {
+		scalar_multiply(curve, &k[i], &res[i]);
+		point_add(curve, &p[i], &res[i]);
+	}
+#endif
+}
+
+// Recode k into 64 odd signed digits, k = sum_{i=0..63} d[i] 16^i
+// (mod curve->order), using the same representation as point_multiply.
+// Returns 0 and leaves d untouched if k is zero.
+static int recode_scalar(const ecdsa_curve *curve, const bignum256 *k, int8_t *d)
+{
+	int i, j;
+	bignum256 a;
+	uint32_t is_even = (k->val[0] & 1) - 1;
+	uint32_t bits;
+
+	// a = k + 2^256, minus curve->order if k is even, so a is odd.
+	uint32_t tmp = 1;
+	uint32_t is_non_zero = 0;
+	for (j = 0; j < 8; j++) {
+		is_non_zero |= k->val[j];
+		tmp += 0x3fffffff + k->val[j] - (curve->order.val[j] & is_even);
+		a.val[j] = tmp & 0x3fffffff;
+		tmp >>= 30;
+	}
+	is_non_zero |= k->val[j];
+	a.val[j] = tmp + 0xffff + k->val[j] - (curve->order.val[j] & is_even);
+	if (!is_non_zero) {
+		return 0;
+	}
+
+	for (i = 0; i < 64; i++) {
+		// lowest 5 bits of a >> (i*4)
+		j = (i * 4) / 30;
+		bits = a.val[j] >> ((i * 4) % 30);
+		if ((i * 4) % 30 > 25) {
+			bits |= a.val[j + 1] << (30 - (i * 4) % 30);
+		}
+		bits &= 31;
+		if (bits & 16) {
+			d[i] = (bits & 15) | 1;
+		} else {
+			d[i] = -(int8_t)((~bits & 15) | 1);
+		}
+	}
+	MEMSET_BZERO(&a, sizeof(a));
+	return 1;
+}
+
+// Add d * table[|d| >> 1] to jres.  *is_infinity tracks whether jres
+// holds the point at infinity, which jacobian_curve_point cannot
+// represent.  The scalars are public, so a signature can be chosen to
+// make the sum cancel; point_jacobian_add then leaves z = 0.
+static void point_jacobian_add_digit(const curve_point *table, int8_t d, jacobian_curve_point *jres, int *is_infinity, const ecdsa_curve *curve)
+{
+	bignum256 z;
+	curve_point t = table[(d < 0 ? -d : d) >> 1];
+	if (d < 0) {
+		bn_subtract(&curve->prime, &t.y, &t.y);
+	}
+	if (*is_infinity) {
+		jres->x = t.x;
+		jres->y = t.y;
+		bn_zero(&jres->z);
+		jres->z.val[0] = 1;
+		*is_infinity = 0;
+	} else {
+		point_jacobian_add(&t, jres, curve);
+		z = jres->z;
+		bn_mod(&z, &curve->prime);
+		*is_infinity = bn_is_zero(&z);
+	}
+}
+
+// res = k1 * G + k2 * p
+// k1 and k2 must be normalized numbers with 0 <= k < curve->order.
+// Both products are accumulated in a single pass of 4-bit windows that
+// share the doublings, and res is normalized with one inversion at the
+// end.  This is not constant time; use it only with public scalars, as
+// in signature verification.
+void ecdsa_double_scalar_multiply(const ecdsa_curve *curve, const bignum256 *k1, const bignum256 *k2, const curve_point *p, curve_point *res)
+{
+	assert (bn_is_less(k1, &curve->order));
+	assert (bn_is_less(k2, &curve->order));
+
+	int i;
+	int8_t d1[64], d2[64];
+	int has1, has2;
+	int is_infinity = 1;
+	jacobian_curve_point jres;
+	curve_point pmult[8];
+	const curve_point *gmult;
+#if !USE_PRECOMPUTED_CP
+	curve_point gtable[8];
+#endif
+
+	has1 = recode_scalar(curve, k1, d1);
+	has2 = recode_scalar(curve, k2, d2);
+	if (!has2) {
+		scalar_multiply(curve, k1, res);
+		return;
+	}
+	if (!has1) {
+		point_multiply(curve, k2, p, res);
+		return;
+	}
+
+#if USE_PRECOMPUTED_CP
+	// curve->cp[0][j] = (2*j+1) * G
+	gmult = curve->cp[0];
+#else
+	point_odd_multiples(curve, &curve->G, gtable);
+	gmult = gtable;
+#endif
+	point_odd_multiples(curve, p, pmult);
+
+	for (i = 63; i >= 0; i--) {
+		if (!is_infinity) {
+			point_jacobian_double(&jres, curve);
+			point_jacobian_double(&jres, curve);
+			point_jacobian_double(&jres, curve);
+			point_jacobian_double(&jres, curve);
+		}
+		point_jacobian_add_digit(pmult, d2[i], &jres, &is_infinity, curve);
+		point_jacobian_add_digit(gmult, d1[i], &jres, &is_infinity, curve);
+	}
+	if (is_infinity) {
+		point_set_infinity(res);
+		return;
+	}
+	jacobian_to_curve(&jres, res, curve);
+}
+
 // generate random K for signing
 int generate_k_random(const ecdsa_curve *curve, bignum256 *k) {
 	int i, j;
@@ -905,9 +1187,9 @@ void uncompress_coords(const ecdsa_curve *curve, uint8_t odd, const bignum256 *x
 {
 	// y^2 = x^3 + a*x + b
 	memcpy(y, x, sizeof(bignum256));         // y is x
-	bn_multiply(x, y, &curve->prime);        // y is x^2
+	field_multiply(curve, x, y);             // y is x^2
 	bn_subi(y, -curve->a, &curve->prime);    // y is x^2 + a
-	bn_multiply(x, y, &curve->prime);        // y is x^3 + ax
+	field_multiply(curve, x, y);             // y is x^3 + ax
 	bn_add(y, &curve->b);                    // y is x^3 + ax + b
 	bn_sqrt(y, &curve->prime);               // y = sqrt(y)
 	if ((odd & 0x01) != (y->val[0] & 1)) {
@@ -955,13 +1237,13 @@ int ecdsa_validate_pubkey(const ecdsa_curve *curve, const curve_point *pub)
 	memcpy(&x3_ax_b, &(pub->x), sizeof(bignum256));
 
 	// y^2
-	bn_multiply(&(pub->y), &y_2, &curve->prime);
+	field_multiply(curve, &(pub->y), &y_2);
 	bn_mod(&y_2, &curve->prime);
 
 	// x^3 + ax + b
-	bn_multiply(&(pub->x), &x3_ax_b, &curve->prime);  // x^2
+	field_multiply(curve, &(pub->x), &x3_ax_b);       // x^2
 	bn_subi(&x3_ax_b, -curve->a, &curve->prime);      // x^2 + a
-	bn_multiply(&(pub->x), &x3_ax_b, &curve->prime);  // x^3 + ax
+	field_multiply(curve, &(pub->x), &x3_ax_b);       // x^3 + ax
 	bn_addmod(&x3_ax_b, &curve->b, &curve->prime);    // x^3 + ax + b
 	bn_mod(&x3_ax_b, &curve->prime);
 
@@ -1002,7 +1284,7 @@ int ecdsa_verify_double(const ecdsa_curve *curve, const uint8_t *pub_key, const
 int ecdsa_verify_digest_recover(const ecdsa_curve *curve, uint8_t *pub_key, const uint8_t *sig, const uint8_t *digest, int recid)
 {
 	bignum256 r, s, e;
-	curve_point cp, cp2;
+	curve_point cp;
 
 	// read r and s
 	bn_read_be(sig, &r);
@@ -1033,14 +1315,16 @@ int ecdsa_verify_digest_recover(const ecdsa_curve *curve, uint8_t *pub_key, cons
 	bn_mod(&e, &curve->order);
 	// r := r^-1
 	bn_inverse(&r, &curve->order);
-	// cp := s * R = s * k *G
-	point_multiply(curve, &s, &cp, &cp);
-	// cp2 := -digest * G
-	scalar_multiply(curve, &e, &cp2);
-	// cp := (s * k - digest) * G = (r*priv) * G = r * Pub
-	point_add(curve, &cp2, &cp);
-	// cp := r^{-1} * r * Pub = Pub
-	point_multiply(curve, &r, &cp, &cp);
+	// e := -digest * r^-1, s := s * r^-1
+	bn_multiply(&r, &e, &curve->order);
+	bn_mod(&e, &curve->order);
+	bn_multiply(&r, &s, &curve->order);
+	bn_mod(&s, &curve->order);
+	// Pub = r^-1 * (s * R - digest * G) = (-digest * r^-1) * G + (s * r^-1) * R
+	ecdsa_double_scalar_multiply(curve, &e, &s, &cp, &cp);
+	if (point_is_infinity(&cp)) {
+		return 1;
+	}
 	pub_key[0] = 0x04;
 	bn_write_be(&cp.x, pub_key + 1);
 	bn_write_be(&cp.y, pub_key + 33);
@@ -1077,14 +1361,11 @@ int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key, const
 		// our message hashes to zero
 		// I don't expect this to happen any time soon
 		result = 3;
-	} else {
-		scalar_multiply(curve, &z, &res);
 	}
 
 	if (result == 0) {
-		// both pub and res can be infinity, can have y = 0 OR can be equal -> false negative
-		point_multiply(curve, &s, &pub, &pub);
-		point_add(curve, &pub, &res);
+		// res = z*s^-1 * G + r*s^-1 * pub
+		ecdsa_double_scalar_multiply(curve, &z, &s, &pub, &res);
 		bn_mod(&(res.x), &curve->order);
 		// signature does not match
 		if (!bn_is_equal(&res.x, &r)) {
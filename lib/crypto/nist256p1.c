@@ -23,6 +23,48 @@
 
 #include "keepkey/crypto/nist256p1.h"
 
+// Reduce the product res modulo prime = 2^256 - 2^224 + 2^192 + 2^96 - 1.
+// This follows bn_multiply_reduce_step, but instead of subtracting
+// coef * prime limb by limb it clears coef * 2^256 and adds
+// coef * (2^224 - 2^192 - 2^96 + 1), which only touches four limbs at
+// fixed shifts: 2^96 = 2^6 in limb 3, 2^192 = 2^12 in limb 6 and
+// 2^224 = 2^14 in limb 7.  No multiplications are needed.
+// assumes    res normalized, res < 2^270 * 2 * prime
+// guarantees x partly reduced, i.e., x < 2 * prime
+static void nist256p1_multiply_reduce(bignum256 *x, uint32_t res[18], const bignum256 *prime)
+{
+	int i, j;
+	uint32_t coef;
+	uint64_t temp;
+	uint64_t delta[10] = {0};
+
+	(void)prime;
+
+	for (i = 16; i >= 8; i--) {
+		// coef = res / 2^(30(i-8) + 256), 0 <= coef < 2^31
+		coef = (res[i] >> 16) + (res[i + 1] << 14);
+		res[i] &= 0xFFFF;
+		res[i + 1] = 0;
+		// delta[j] is added to limb i - 8 + j; negative entries wrap
+		// around but never make temp go below zero thanks to the bias.
+		delta[0] = coef;
+		delta[3] = -((uint64_t)coef << 6);
+		delta[6] = -((uint64_t)coef << 12);
+		delta[7] = (uint64_t)coef << 14;
+		temp = 0x2000000000000000ull + res[i - 8] + delta[0];
+		res[i - 8] = temp & 0x3FFFFFFF;
+		for (j = 1; j < 10; j++) {
+			temp >>= 30;
+			temp += 0x1FFFFFFF80000000ull + res[i - 8 + j] + delta[j];
+			res[i - 8 + j] = temp & 0x3FFFFFFF;
+		}
+		// as in bn_multiply_reduce_step, res < 2^(30(i-8)) * 2 * prime
+	}
+	for (i = 0; i < 9; i++) {
+		x->val[i] = res[i];
+	}
+}
+
 const ecdsa_curve nist256p1 = {
 	/* .prime */ {
 		/*.val =*/ {0x3fffffff, 0x3fffffff, 0x3fffffff, 0x3f, 0x0, 0x0, 0x1000, 0x3fffc000, 0xffff}
@@ -45,7 +87,9 @@ const ecdsa_curve nist256p1 = {
 
 	/* b */ {
 		/*.val =*/{0x27d2604b, 0x2f38f0f8, 0x53b0f63, 0x741ac33, 0x1886bc65, 0x2ef555da, 0x293e7b3e, 0xd762a8e, 0x5ac6}
-	}
+	},
+
+	/* multiply_reduce */ nist256p1_multiply_reduce
 
 #if USE_PRECOMPUTED_CP
 	,
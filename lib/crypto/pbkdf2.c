@@ -120,13 +120,13 @@ void pbkdf2_hmac_sha512_Update(PBKDF2_HMAC_SHA512_CTX *pctx, uint32_t iterations
                                void (*progress_callback)(uint32_t current, uint32_t total))
 {
 	for (uint32_t i = pctx->first; i < iterations; i++) {
-		sha512_Transform(pctx->idig, pctx->g, pctx->g);
-		sha512_Transform(pctx->odig, pctx->g, pctx->g);
+		sha512_Transform_digest(pctx->idig, pctx->g, pctx->g);
+		sha512_Transform_digest(pctx->odig, pctx->g, pctx->g);
 		for (uint32_t j = 0; j < SHA512_DIGEST_LENGTH / sizeof(uint64_t); j++) {
 			pctx->f[j] ^= pctx->g[j];
-			if (progress_callback) {
-				progress_callback(j + 1, iterations);
-			}
+		}
+		if (progress_callback) {
+			progress_callback(i + 1, iterations);
 		}
 	}
 	pctx->first = 0;
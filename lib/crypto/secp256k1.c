@@ -23,6 +23,59 @@
 
 #include "keepkey/crypto/secp256k1.h"
 
+// Reduce the product res modulo prime = 2^256 - 2^32 - 977.
+// Since 2^256 = 2^32 + 977 (mod prime), the bits above 2^256 are folded
+// back in as multiples of 2^32 + 977, which is just 0x3d1 in limb 0 and
+// 4 in limb 1.  Two folds replace the nine generic reduction steps.
+// assumes    res normalized, res < 2^270 * 2 * prime
+// guarantees x partly reduced, i.e., x < 2 * prime
+static void secp256k1_multiply_reduce(bignum256 *x, uint32_t res[18], const bignum256 *prime)
+{
+	int j;
+	uint32_t h[10];
+	uint64_t temp;
+
+	(void)prime;
+
+	// h = res >> 256 < 2^272
+	for (j = 0; j < 9; j++) {
+		h[j] = ((res[8 + j] >> 16) | (res[9 + j] << 14)) & 0x3FFFFFFF;
+	}
+	h[9] = res[17] >> 16;
+	res[8] &= 0xFFFF;
+
+	// res = (res mod 2^256) + h * (2^32 + 977) < 2^305
+	temp = 0;
+	for (j = 0; j < 11; j++) {
+		if (j < 9) temp += res[j];
+		if (j < 10) temp += h[j] * 977ull;
+		if (j > 0) temp += (uint64_t)h[j - 1] << 2;
+		res[j] = temp & 0x3FFFFFFF;
+		temp >>= 30;
+	}
+
+	// fold the remaining h = res >> 256 < 2^49 once more
+	h[0] = ((res[8] >> 16) | (res[9] << 14)) & 0x3FFFFFFF;
+	h[1] = (res[9] >> 16) | (res[10] << 14);
+	res[8] &= 0xFFFF;
+
+	// x = (res mod 2^256) + h * (2^32 + 977) < 2^256 + 2^82 < 2 * prime
+	temp = res[0] + h[0] * 977ull;
+	x->val[0] = temp & 0x3FFFFFFF;
+	temp >>= 30;
+	temp += res[1] + h[1] * 977ull + ((uint64_t)h[0] << 2);
+	x->val[1] = temp & 0x3FFFFFFF;
+	temp >>= 30;
+	temp += res[2] + ((uint64_t)h[1] << 2);
+	x->val[2] = temp & 0x3FFFFFFF;
+	temp >>= 30;
+	for (j = 3; j < 9; j++) {
+		temp += res[j];
+		x->val[j] = temp & 0x3FFFFFFF;
+		temp >>= 30;
+	}
+}
+
 const ecdsa_curve secp256k1 = {
 	/* .prime */ {
 		/*.val =*/ {0x3ffffc2f, 0x3ffffffb, 0x3fffffff, 0x3fffffff, 0x3fffffff, 0x3fffffff, 0x3fffffff, 0x3fffffff, 0xffff}
@@ -45,7 +98,9 @@ const ecdsa_curve secp256k1 = {
 
 	/* b */ {
 		/*.val =*/{7}
-	}
+	},
+
+	/* multiply_reduce */ secp256k1_multiply_reduce
 
 #if USE_PRECOMPUTED_CP
 	,
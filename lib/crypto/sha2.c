@@ -42,16 +42,11 @@
  * defined.  Check your own systems manpage on assert() to see how to
  * compile WITHOUT the sanity checking code on your system.
  *
- * UNROLLED TRANSFORM LOOP NOTE:
- * You can define SHA2_UNROLL_TRANSFORM to use the unrolled transform
- * loop version for the hash transform rounds (defined using macros
- * later in this file).  Either define on the command line, for example:
- *
- *   cc -DSHA2_UNROLL_TRANSFORM -o sha2 sha2.c sha2prog.c
- *
- * or define below:
- *
- *   #define SHA2_UNROLL_TRANSFORM
+ * UNROLLED TRANSFORM NOTE:
+ * The SHA-256 rounds are fully unrolled and the SHA-512 rounds are
+ * unrolled eight at a time.  Whole blocks passed to the Update functions
+ * are hashed straight from the caller's buffer without going through the
+ * context buffer.
  *
  */
 
@@ -267,48 +262,45 @@ void sha256_Init(SHA256_CTX* context) {
 	context->bitcount = 0;
 }
 
-#ifdef SHA2_UNROLL_TRANSFORM
-
-/* Unrolled SHA-256 round macros: */
+/* Load a big-endian word from a buffer of any alignment */
+#define LOAD32_BE(p) \
+	(((sha2_word32)(p)[0] << 24) | ((sha2_word32)(p)[1] << 16) | \
+	 ((sha2_word32)(p)[2] << 8) | (sha2_word32)(p)[3])
 
-#if BYTE_ORDER == LITTLE_ENDIAN
-
-#define ROUND256_0_TO_15(a,b,c,d,e,f,g,h)	\
-	W256[j] = *data++; \
-	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + \
-             K256[j] + W256[j]; \
+/* SHA-256 round and message expansion macros; j is a constant after
+ * unrolling, so each round constant becomes an immediate */
+#define ROUND256(a,b,c,d,e,f,g,h,j)	\
+	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + K256[j] + W256[(j)&0x0f]; \
 	(d) += T1; \
-	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
-	j++
-
-
-#else /* BYTE_ORDER == LITTLE_ENDIAN */
-
-#define ROUND256_0_TO_15(a,b,c,d,e,f,g,h)	\
-	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + \
-	     K256[j] + (W256[j] = *data++); \
-	(d) += T1; \
-	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
-	j++
-
-#endif /* BYTE_ORDER == LITTLE_ENDIAN */
-
-#define ROUND256(a,b,c,d,e,f,g,h)	\
-	s0 = W256[(j+1)&0x0f]; \
-	s0 = sigma0_256(s0); \
-	s1 = W256[(j+14)&0x0f]; \
-	s1 = sigma1_256(s1); \
-	T1 = (h) + Sigma1_256(e) + Ch((e), (f), (g)) + K256[j] + \
-	     (W256[j&0x0f] += s1 + W256[(j+9)&0x0f] + s0); \
-	(d) += T1; \
-	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
-	j++
-
-void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
-	sha2_word32	a, b, c, d, e, f, g, h, s0, s1;
-	sha2_word32	T1;
-	sha2_word32 W256[16];
-	int		j;
+	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c))
+
+#define EXPAND256(j)	\
+	W256[(j)&0x0f] += sigma1_256(W256[((j)+14)&0x0f]) + \
+	                  W256[((j)+9)&0x0f] + sigma0_256(W256[((j)+1)&0x0f])
+
+#define ROUNDS256_0_TO_15(j)	\
+	ROUND256(a,b,c,d,e,f,g,h,(j)+0); \
+	ROUND256(h,a,b,c,d,e,f,g,(j)+1); \
+	ROUND256(g,h,a,b,c,d,e,f,(j)+2); \
+	ROUND256(f,g,h,a,b,c,d,e,(j)+3); \
+	ROUND256(e,f,g,h,a,b,c,d,(j)+4); \
+	ROUND256(d,e,f,g,h,a,b,c,(j)+5); \
+	ROUND256(c,d,e,f,g,h,a,b,(j)+6); \
+	ROUND256(b,c,d,e,f,g,h,a,(j)+7)
+
+#define ROUNDS256(j)	\
+	EXPAND256((j)+0); ROUND256(a,b,c,d,e,f,g,h,(j)+0); \
+	EXPAND256((j)+1); ROUND256(h,a,b,c,d,e,f,g,(j)+1); \
+	EXPAND256((j)+2); ROUND256(g,h,a,b,c,d,e,f,(j)+2); \
+	EXPAND256((j)+3); ROUND256(f,g,h,a,b,c,d,e,(j)+3); \
+	EXPAND256((j)+4); ROUND256(e,f,g,h,a,b,c,d,(j)+4); \
+	EXPAND256((j)+5); ROUND256(d,e,f,g,h,a,b,c,(j)+5); \
+	EXPAND256((j)+6); ROUND256(c,d,e,f,g,h,a,b,(j)+6); \
+	EXPAND256((j)+7); ROUND256(b,c,d,e,f,g,h,a,(j)+7)
+
+/* All 64 rounds over the message words in W256, which they overwrite */
+static void sha256_Rounds(const sha2_word32* state_in, sha2_word32* W256, sha2_word32* state_out) {
+	sha2_word32	a, b, c, d, e, f, g, h, T1;
 
 	/* Initialize registers with the prev. intermediate value */
 	a = state_in[0];
@@ -320,30 +312,14 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	g = state_in[6];
 	h = state_in[7];
 
-	j = 0;
-	do {
-		/* Rounds 0 to 15 (unrolled): */
-		ROUND256_0_TO_15(a,b,c,d,e,f,g,h);
-		ROUND256_0_TO_15(h,a,b,c,d,e,f,g);
-		ROUND256_0_TO_15(g,h,a,b,c,d,e,f);
-		ROUND256_0_TO_15(f,g,h,a,b,c,d,e);
-		ROUND256_0_TO_15(e,f,g,h,a,b,c,d);
-		ROUND256_0_TO_15(d,e,f,g,h,a,b,c);
-		ROUND256_0_TO_15(c,d,e,f,g,h,a,b);
-		ROUND256_0_TO_15(b,c,d,e,f,g,h,a);
-	} while (j < 16);
-
-	/* Now for the remaining rounds to 64: */
-	do {
-		ROUND256(a,b,c,d,e,f,g,h);
-		ROUND256(h,a,b,c,d,e,f,g);
-		ROUND256(g,h,a,b,c,d,e,f);
-		ROUND256(f,g,h,a,b,c,d,e);
-		ROUND256(e,f,g,h,a,b,c,d);
-		ROUND256(d,e,f,g,h,a,b,c);
-		ROUND256(c,d,e,f,g,h,a,b);
-		ROUND256(b,c,d,e,f,g,h,a);
-	} while (j < 64);
+	ROUNDS256_0_TO_15(0);
+	ROUNDS256_0_TO_15(8);
+	ROUNDS256(16);
+	ROUNDS256(24);
+	ROUNDS256(32);
+	ROUNDS256(40);
+	ROUNDS256(48);
+	ROUNDS256(56);
 
 	/* Compute the current intermediate hash value */
 	state_out[0] = state_in[0] + a;
@@ -359,79 +335,27 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	a = b = c = d = e = f = g = h = T1 = 0;
 }
 
-#else /* SHA2_UNROLL_TRANSFORM */
-
 void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
-	sha2_word32	a, b, c, d, e, f, g, h, s0, s1;
-	sha2_word32	T1, T2, W256[16];
-	int		j;
+	sha2_word32	W256[16];
 
-	/* Initialize registers with the prev. intermediate value */
-	a = state_in[0];
-	b = state_in[1];
-	c = state_in[2];
-	d = state_in[3];
-	e = state_in[4];
-	f = state_in[5];
-	g = state_in[6];
-	h = state_in[7];
-
-	j = 0;
-	do {
-		/* Apply the SHA-256 compression function to update a..h with copy */
-		T1 = h + Sigma1_256(e) + Ch(e, f, g) + K256[j] + (W256[j] = *data++);
-		T2 = Sigma0_256(a) + Maj(a, b, c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + T1;
-		d = c;
-		c = b;
-		b = a;
-		a = T1 + T2;
-
-		j++;
-	} while (j < 16);
-
-	do {
-		/* Part of the message block expansion: */
-		s0 = W256[(j+1)&0x0f];
-		s0 = sigma0_256(s0);
-		s1 = W256[(j+14)&0x0f];	
-		s1 = sigma1_256(s1);
-
-		/* Apply the SHA-256 compression function to update a..h */
-		T1 = h + Sigma1_256(e) + Ch(e, f, g) + K256[j] + 
-		     (W256[j&0x0f] += s1 + W256[(j+9)&0x0f] + s0);
-		T2 = Sigma0_256(a) + Maj(a, b, c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + T1;
-		d = c;
-		c = b;
-		b = a;
-		a = T1 + T2;
-
-		j++;
-	} while (j < 64);
+	MEMCPY_BCOPY(W256, data, SHA256_BLOCK_LENGTH);
+	sha256_Rounds(state_in, W256, state_out);
+}
 
-	/* Compute the current intermediate hash value */
-	state_out[0] = state_in[0] + a;
-	state_out[1] = state_in[1] + b;
-	state_out[2] = state_in[2] + c;
-	state_out[3] = state_in[3] + d;
-	state_out[4] = state_in[4] + e;
-	state_out[5] = state_in[5] + f;
-	state_out[6] = state_in[6] + g;
-	state_out[7] = state_in[7] + h;
+/* Hash whole blocks straight from the caller's buffer */
+static void sha256_Transform_blocks(sha2_word32* state, const sha2_byte* data, size_t blocks) {
+	sha2_word32	W256[16];
 
-	/* Clean up */
-	a = b = c = d = e = f = g = h = T1 = T2 = 0;
+	while (blocks--) {
+		for (int j = 0; j < 16; j++) {
+			W256[j] = LOAD32_BE(data + 4 * j);
+		}
+		sha256_Rounds(state, W256, state);
+		data += SHA256_BLOCK_LENGTH;
+	}
+	MEMSET_BZERO(W256, sizeof(W256));
 }
 
-#endif /* SHA2_UNROLL_TRANSFORM */
-
 void sha256_Update(SHA256_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace, usedspace;
 
@@ -467,19 +391,13 @@ void sha256_Update(SHA256_CTX* context, const sha2_byte *data, size_t len) {
 			return;
 		}
 	}
-	while (len >= SHA256_BLOCK_LENGTH) {
+	if (len >= SHA256_BLOCK_LENGTH) {
 		/* Process as many complete blocks as we can */
-		MEMCPY_BCOPY(context->buffer, data, SHA256_BLOCK_LENGTH);
-#if BYTE_ORDER == LITTLE_ENDIAN
-		/* Convert TO host byte order */
-		for (int j = 0; j < 16; j++) {
-			REVERSE32(context->buffer[j],context->buffer[j]);
-		}
-#endif
-		sha256_Transform(context->state, context->buffer, context->state);
-		context->bitcount += SHA256_BLOCK_LENGTH << 3;
-		len -= SHA256_BLOCK_LENGTH;
-		data += SHA256_BLOCK_LENGTH;
+		size_t blocks = len / SHA256_BLOCK_LENGTH;
+		sha256_Transform_blocks(context->state, data, blocks);
+		context->bitcount += (sha2_word64)blocks * SHA256_BLOCK_LENGTH << 3;
+		len -= blocks * SHA256_BLOCK_LENGTH;
+		data += blocks * SHA256_BLOCK_LENGTH;
 	}
 	if (len > 0) {
 		/* There's left-overs, so save 'em */
@@ -590,30 +508,47 @@ void sha512_Init(SHA512_CTX* context) {
 	context->bitcount[0] = context->bitcount[1] =  0;
 }
 
-#ifdef SHA2_UNROLL_TRANSFORM
+/* Load a big-endian word from a buffer of any alignment */
+#define LOAD64_BE(p) \
+	(((sha2_word64)LOAD32_BE(p) << 32) | (sha2_word64)LOAD32_BE((p) + 4))
 
-/* Unrolled SHA-512 round macros: */
-#define ROUND512_0_TO_15(a,b,c,d,e,f,g,h)	\
-	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + \
-             K512[j] + (W512[j] = *data++); \
+/* SHA-512 round and message expansion macros */
+#define ROUND512(a,b,c,d,e,f,g,h,j)	\
+	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + K512[j] + W512[(j)&0x0f]; \
 	(d) += T1; \
-	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c)); \
-	j++
-
-#define ROUND512(a,b,c,d,e,f,g,h)	\
-	s0 = W512[(j+1)&0x0f]; \
-	s0 = sigma0_512(s0); \
-	s1 = W512[(j+14)&0x0f]; \
-	s1 = sigma1_512(s1); \
-	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + K512[j] + \
-             (W512[j&0x0f] += s1 + W512[(j+9)&0x0f] + s0); \
-	(d) += T1; \
-	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c)); \
-	j++
+	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c))
+
+#define EXPAND512(j)	\
+	W512[(j)&0x0f] += sigma1_512(W512[((j)+14)&0x0f]) + \
+	                  W512[((j)+9)&0x0f] + sigma0_512(W512[((j)+1)&0x0f])
+
+#define ROUNDS512_0_TO_15(j)	\
+	ROUND512(a,b,c,d,e,f,g,h,(j)+0); \
+	ROUND512(h,a,b,c,d,e,f,g,(j)+1); \
+	ROUND512(g,h,a,b,c,d,e,f,(j)+2); \
+	ROUND512(f,g,h,a,b,c,d,e,(j)+3); \
+	ROUND512(e,f,g,h,a,b,c,d,(j)+4); \
+	ROUND512(d,e,f,g,h,a,b,c,(j)+5); \
+	ROUND512(c,d,e,f,g,h,a,b,(j)+6); \
+	ROUND512(b,c,d,e,f,g,h,a,(j)+7)
+
+#define ROUNDS512(j)	\
+	EXPAND512((j)+0); ROUND512(a,b,c,d,e,f,g,h,(j)+0); \
+	EXPAND512((j)+1); ROUND512(h,a,b,c,d,e,f,g,(j)+1); \
+	EXPAND512((j)+2); ROUND512(g,h,a,b,c,d,e,f,(j)+2); \
+	EXPAND512((j)+3); ROUND512(f,g,h,a,b,c,d,e,(j)+3); \
+	EXPAND512((j)+4); ROUND512(e,f,g,h,a,b,c,d,(j)+4); \
+	EXPAND512((j)+5); ROUND512(d,e,f,g,h,a,b,c,(j)+5); \
+	EXPAND512((j)+6); ROUND512(c,d,e,f,g,h,a,b,(j)+6); \
+	EXPAND512((j)+7); ROUND512(b,c,d,e,f,g,h,a,(j)+7)
 
-void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2_word64* state_out) {
-	sha2_word64	a, b, c, d, e, f, g, h, s0, s1;
-	sha2_word64	T1, W512[16];
+/*
+ * All 80 rounds over the message words in W512, which they overwrite.
+ * 64-bit arithmetic is expensive on the device, so the expanded rounds
+ * stay in an eight round loop to keep the code small.
+ */
+static void sha512_Rounds(const sha2_word64* state_in, sha2_word64* W512, sha2_word64* state_out) {
+	sha2_word64	a, b, c, d, e, f, g, h, T1;
 	int		j;
 
 	/* Initialize registers with the prev. intermediate value */
@@ -626,29 +561,11 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	g = state_in[6];
 	h = state_in[7];
 
-	j = 0;
-	do {
-		ROUND512_0_TO_15(a,b,c,d,e,f,g,h);
-		ROUND512_0_TO_15(h,a,b,c,d,e,f,g);
-		ROUND512_0_TO_15(g,h,a,b,c,d,e,f);
-		ROUND512_0_TO_15(f,g,h,a,b,c,d,e);
-		ROUND512_0_TO_15(e,f,g,h,a,b,c,d);
-		ROUND512_0_TO_15(d,e,f,g,h,a,b,c);
-		ROUND512_0_TO_15(c,d,e,f,g,h,a,b);
-		ROUND512_0_TO_15(b,c,d,e,f,g,h,a);
-	} while (j < 16);
-
-	/* Now for the remaining rounds up to 79: */
-	do {
-		ROUND512(a,b,c,d,e,f,g,h);
-		ROUND512(h,a,b,c,d,e,f,g);
-		ROUND512(g,h,a,b,c,d,e,f);
-		ROUND512(f,g,h,a,b,c,d,e);
-		ROUND512(e,f,g,h,a,b,c,d);
-		ROUND512(d,e,f,g,h,a,b,c);
-		ROUND512(c,d,e,f,g,h,a,b);
-		ROUND512(b,c,d,e,f,g,h,a);
-	} while (j < 80);
+	ROUNDS512_0_TO_15(0);
+	ROUNDS512_0_TO_15(8);
+	for (j = 16; j < 80; j += 8) {
+		ROUNDS512(j);
+	}
 
 	/* Compute the current intermediate hash value */
 	state_out[0] = state_in[0] + a;
@@ -664,14 +581,58 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	a = b = c = d = e = f = g = h = T1 = 0;
 }
 
-#else /* SHA2_UNROLL_TRANSFORM */
-
 void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2_word64* state_out) {
-	sha2_word64	a, b, c, d, e, f, g, h, s0, s1;
-	sha2_word64	T1, T2, W512[16];
+	sha2_word64	W512[16];
+
+	MEMCPY_BCOPY(W512, data, SHA512_BLOCK_LENGTH);
+	sha512_Rounds(state_in, W512, state_out);
+}
+
+/* Hash whole blocks straight from the caller's buffer */
+static void sha512_Transform_blocks(sha2_word64* state, const sha2_byte* data, size_t blocks) {
+	sha2_word64	W512[16];
+
+	while (blocks--) {
+		for (int j = 0; j < 16; j++) {
+			W512[j] = LOAD64_BE(data + 8 * j);
+		}
+		sha512_Rounds(state, W512, state);
+		data += SHA512_BLOCK_LENGTH;
+	}
+	MEMSET_BZERO(W512, sizeof(W512));
+}
+
+/*
+ * Compress a block holding a 64-byte digest followed by the padding of a
+ * 192-byte message. This is the block of both the inner and the outer hash
+ * of every PBKDF2-HMAC-SHA512 iteration after the first, so its last eight
+ * words are constant and the message schedule folds around them.
+ */
+void sha512_Transform_digest(const sha2_word64* state_in, const sha2_word64* digest, sha2_word64* state_out) {
+	sha2_word64	a, b, c, d, e, f, g, h, T1, T2;
+	sha2_word64	W512[80];
 	int		j;
 
-	/* Initialize registers with the prev. intermediate value */
+	for (j = 0; j < 8; j++) {
+		W512[j] = digest[j];
+	}
+	W512[8] = 0x8000000000000000ULL;
+	W512[9] = W512[10] = W512[11] = W512[12] = W512[13] = W512[14] = 0;
+	W512[15] = (SHA512_BLOCK_LENGTH + SHA512_DIGEST_LENGTH) * 8;
+
+	/* The first sixteen expansions read the constant words, spell them
+	 * out so the compiler drops the terms that are zero */
+#define SCHEDULE512(t) \
+	W512[t] = sigma1_512(W512[(t)-2]) + W512[(t)-7] + sigma0_512(W512[(t)-15]) + W512[(t)-16]
+	SCHEDULE512(16); SCHEDULE512(17); SCHEDULE512(18); SCHEDULE512(19);
+	SCHEDULE512(20); SCHEDULE512(21); SCHEDULE512(22); SCHEDULE512(23);
+	SCHEDULE512(24); SCHEDULE512(25); SCHEDULE512(26); SCHEDULE512(27);
+	SCHEDULE512(28); SCHEDULE512(29); SCHEDULE512(30); SCHEDULE512(31);
+	for (j = 32; j < 80; j++) {
+		SCHEDULE512(j);
+	}
+#undef SCHEDULE512
+
 	a = state_in[0];
 	b = state_in[1];
 	c = state_in[2];
@@ -681,10 +642,8 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	g = state_in[6];
 	h = state_in[7];
 
-	j = 0;
-	do {
-		/* Apply the SHA-512 compression function to update a..h with copy */
-		T1 = h + Sigma1_512(e) + Ch(e, f, g) + K512[j] + (W512[j] = *data++);
+	for (j = 0; j < 80; j++) {
+		T1 = h + Sigma1_512(e) + Ch(e, f, g) + K512[j] + W512[j];
 		T2 = Sigma0_512(a) + Maj(a, b, c);
 		h = g;
 		g = f;
@@ -694,34 +653,8 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 		c = b;
 		b = a;
 		a = T1 + T2;
+	}
 
-		j++;
-	} while (j < 16);
-
-	do {
-		/* Part of the message block expansion: */
-		s0 = W512[(j+1)&0x0f];
-		s0 = sigma0_512(s0);
-		s1 = W512[(j+14)&0x0f];
-		s1 =  sigma1_512(s1);
-
-		/* Apply the SHA-512 compression function to update a..h */
-		T1 = h + Sigma1_512(e) + Ch(e, f, g) + K512[j] +
-		     (W512[j&0x0f] += s1 + W512[(j+9)&0x0f] + s0);
-		T2 = Sigma0_512(a) + Maj(a, b, c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + T1;
-		d = c;
-		c = b;
-		b = a;
-		a = T1 + T2;
-
-		j++;
-	} while (j < 80);
-
-	/* Compute the current intermediate hash value */
 	state_out[0] = state_in[0] + a;
 	state_out[1] = state_in[1] + b;
 	state_out[2] = state_in[2] + c;
@@ -735,8 +668,6 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 	a = b = c = d = e = f = g = h = T1 = T2 = 0;
 }
 
-#endif /* SHA2_UNROLL_TRANSFORM */
-
 void sha512_Update(SHA512_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace, usedspace;
 
@@ -772,19 +703,13 @@ void sha512_Update(SHA512_CTX* context, const sha2_byte *data, size_t len) {
 			return;
 		}
 	}
-	while (len >= SHA512_BLOCK_LENGTH) {
+	if (len >= SHA512_BLOCK_LENGTH) {
 		/* Process as many complete blocks as we can */
-		MEMCPY_BCOPY(context->buffer, data, SHA512_BLOCK_LENGTH);
-#if BYTE_ORDER == LITTLE_ENDIAN
-		/* Convert TO host byte order */
-		for (int j = 0; j < 16; j++) {
-			REVERSE64(context->buffer[j],context->buffer[j]);
-		}
-#endif
-		sha512_Transform(context->state, context->buffer, context->state);
-		ADDINC128(context->bitcount, SHA512_BLOCK_LENGTH << 3);
-		len -= SHA512_BLOCK_LENGTH;
-		data += SHA512_BLOCK_LENGTH;
+		size_t blocks = len / SHA512_BLOCK_LENGTH;
+		sha512_Transform_blocks(context->state, data, blocks);
+		ADDINC128(context->bitcount, (sha2_word64)blocks * SHA512_BLOCK_LENGTH << 3);
+		len -= blocks * SHA512_BLOCK_LENGTH;
+		data += blocks * SHA512_BLOCK_LENGTH;
 	}
 	if (len > 0) {
 		/* There's left-overs, so save 'em */
@@ -202,9 +202,65 @@ uint8_t *cryptoHDNodePathToPubkey(const HDNodePathType *hdnodepath)
 	return node.public_key;
 }
 
+int cryptoMultisigPubkeys(const MultisigRedeemScriptType *multisig, uint8_t pubkeys[][33])
+{
+	// Derive all cosigner paths one level at a time, so that the child
+	// points of each level are normalized together.
+	static HDNode node[15], batch[15];
+	uint32_t index[15];
+	size_t slot[15];
+	const uint32_t n = multisig->pubkeys_count;
+	uint32_t depth = 0, d, i, m;
+	if (n > 15) {
+		return 0;
+	}
+	for (i = 0; i < n; i++) {
+		const HDNodePathType *hdnodepath = &(multisig->pubkeys[i]);
+		if (!hdnodepath->node.has_public_key || hdnodepath->node.public_key.size != 33) return 0;
+		if (hdnode_from_xpub(hdnodepath->node.depth, hdnodepath->node.child_num, hdnodepath->node.chain_code.bytes, hdnodepath->node.public_key.bytes, SECP256K1_NAME, &node[i]) == 0) {
+			return 0;
+		}
+		if (hdnodepath->address_n_count > depth) {
+			depth = hdnodepath->address_n_count;
+		}
+	}
+	animating_progress_handler();
+	for (d = 0; d < depth; d++) {
+		m = 0;
+		for (i = 0; i < n; i++) {
+			if (d < multisig->pubkeys[i].address_n_count) {
+				batch[m] = node[i];
+				index[m] = multisig->pubkeys[i].address_n[d];
+				slot[m++] = i;
+			}
+		}
+		if (hdnode_public_ckd_batch(batch, index, m) == 0) {
+			return 0;
+		}
+		for (i = 0; i < m; i++) {
+			node[slot[i]] = batch[i];
+		}
+		animating_progress_handler();
+	}
+	for (i = 0; i < n; i++) {
+		memcpy(pubkeys[i], node[i].public_key, 33);
+	}
+	return 1;
+}
+
 int cryptoMultisigPubkeyIndex(const MultisigRedeemScriptType *multisig, const uint8_t *pubkey)
 {
+	uint8_t pubkeys[15][33];
 	size_t i;
+	if (cryptoMultisigPubkeys(multisig, pubkeys)) {
+		for (i = 0; i < multisig->pubkeys_count; i++) {
+			if (memcmp(pubkeys[i], pubkey, 33) == 0) {
+				return i;
+			}
+		}
+		return -1;
+	}
+	// some cosigner path does not derive; match the ones that do
 	for (i = 0; i < multisig->pubkeys_count; i++) {
 		const uint8_t *node_pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
 		if (node_pubkey && memcmp(node_pubkey, pubkey, 33) == 0) {
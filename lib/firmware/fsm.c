@@ -69,97 +69,21 @@ static uint8_t msg_resp[MAX_FRAME_SIZE] __attribute__((aligned(4)));
 
 static const MessagesMap_t MessagesMap[] =
 {
-    /* Normal Messages */
-    MSG_IN(MessageType_MessageType_Initialize,          Initialize_fields, (void (*)(void *))fsm_msgInitialize, AnyVariant)
-    MSG_IN(MessageType_MessageType_GetFeatures,         GetFeatures_fields, (void (*)(void *))fsm_msgGetFeatures, AnyVariant)
-    MSG_IN(MessageType_MessageType_GetCoinTable,        GetCoinTable_fields, (void (*)(void *))fsm_msgGetCoinTable, AnyVariant)
-    MSG_IN(MessageType_MessageType_Ping,                Ping_fields, (void (*)(void *))fsm_msgPing, AnyVariant)
-    MSG_IN(MessageType_MessageType_ChangePin,           ChangePin_fields, (void (*)(void *))fsm_msgChangePin, MFRProhibited)
-    MSG_IN(MessageType_MessageType_WipeDevice,          WipeDevice_fields, (void (*)(void *))fsm_msgWipeDevice, MFRProhibited)
-    MSG_IN(MessageType_MessageType_FirmwareErase,       FirmwareErase_fields, (void (*)(void *))fsm_msgFirmwareErase, AnyVariant)
-    MSG_IN(MessageType_MessageType_FirmwareUpload,      FirmwareUpload_fields, (void (*)(void *))fsm_msgFirmwareUpload, AnyVariant)
-    MSG_IN(MessageType_MessageType_GetEntropy,          GetEntropy_fields, (void (*)(void *))fsm_msgGetEntropy, AnyVariant)
-    MSG_IN(MessageType_MessageType_GetPublicKey,        GetPublicKey_fields, (void (*)(void *))fsm_msgGetPublicKey, MFRProhibited)
-    MSG_IN(MessageType_MessageType_LoadDevice,          LoadDevice_fields, (void (*)(void *))fsm_msgLoadDevice, MFRProhibited)
-    MSG_IN(MessageType_MessageType_ResetDevice,         ResetDevice_fields, (void (*)(void *))fsm_msgResetDevice, MFRProhibited)
-    MSG_IN(MessageType_MessageType_SignTx,              SignTx_fields, (void (*)(void *))fsm_msgSignTx, MFRProhibited)
-    MSG_IN(MessageType_MessageType_PinMatrixAck,        PinMatrixAck_fields,        NO_PROCESS_FUNC, MFRProhibited)
-    MSG_IN(MessageType_MessageType_Cancel,              Cancel_fields, (void (*)(void *))fsm_msgCancel, AnyVariant)
-    MSG_IN(MessageType_MessageType_TxAck,               TxAck_fields, (void (*)(void *))fsm_msgTxAck, MFRProhibited)
-    MSG_IN(MessageType_MessageType_CipherKeyValue,      CipherKeyValue_fields, (void (*)(void *))fsm_msgCipherKeyValue, MFRProhibited)
-    MSG_IN(MessageType_MessageType_ClearSession,        ClearSession_fields, (void (*)(void *))fsm_msgClearSession, AnyVariant)
-    MSG_IN(MessageType_MessageType_ApplySettings,       ApplySettings_fields, (void (*)(void *))fsm_msgApplySettings, MFRProhibited)
-    MSG_IN(MessageType_MessageType_ButtonAck,           ButtonAck_fields,           NO_PROCESS_FUNC, AnyVariant)
-    MSG_IN(MessageType_MessageType_GetAddress,          GetAddress_fields, (void (*)(void *))fsm_msgGetAddress, MFRProhibited)
-    MSG_IN(MessageType_MessageType_EntropyAck,          EntropyAck_fields, (void (*)(void *))fsm_msgEntropyAck, AnyVariant)
-    MSG_IN(MessageType_MessageType_SignMessage,         SignMessage_fields, (void (*)(void *))fsm_msgSignMessage, MFRProhibited)
-    MSG_IN(MessageType_MessageType_SignIdentity,        SignIdentity_fields, (void (*)(void *))fsm_msgSignIdentity, MFRProhibited)
-    MSG_IN(MessageType_MessageType_VerifyMessage,       VerifyMessage_fields, (void (*)(void *))fsm_msgVerifyMessage, MFRProhibited)
-/* ECIES disabled
-    MSG_IN(MessageType_MessageType_EncryptMessage,      EncryptMessage_fields, (void (*)(void *))fsm_msgEncryptMessage, MFRProhibited)
-    MSG_IN(MessageType_MessageType_DecryptMessage,      DecryptMessage_fields, (void (*)(void *))fsm_msgDecryptMessage, MFRProhibited)
-*/
-    MSG_IN(MessageType_MessageType_PassphraseAck,       PassphraseAck_fields,       NO_PROCESS_FUNC, MFRProhibited)
-    MSG_IN(MessageType_MessageType_EstimateTxSize,      EstimateTxSize_fields, (void (*)(void *))fsm_msgEstimateTxSize, MFRProhibited)
-    MSG_IN(MessageType_MessageType_RecoveryDevice,      RecoveryDevice_fields, (void (*)(void *))fsm_msgRecoveryDevice, MFRProhibited)
-    MSG_IN(MessageType_MessageType_WordAck,             WordAck_fields, (void (*)(void *))fsm_msgWordAck, MFRProhibited)
-    MSG_IN(MessageType_MessageType_CharacterAck,        CharacterAck_fields, (void (*)(void *))fsm_msgCharacterAck, MFRProhibited)
-    MSG_IN(MessageType_MessageType_ApplyPolicies,       ApplyPolicies_fields, (void (*)(void *))fsm_msgApplyPolicies, MFRProhibited)
-    MSG_IN(MessageType_MessageType_EthereumGetAddress,	EthereumGetAddress_fields, (void (*)(void *))fsm_msgEthereumGetAddress, MFRProhibited)
-    MSG_IN(MessageType_MessageType_EthereumSignTx,      EthereumSignTx_fields, (void (*)(void *))fsm_msgEthereumSignTx, MFRProhibited)
-    MSG_IN(MessageType_MessageType_EthereumTxAck,       EthereumTxAck_fields, (void (*)(void *))fsm_msgEthereumTxAck, MFRProhibited)
-
-    /* Normal Raw Messages */
-    RAW_IN(MessageType_MessageType_RawTxAck,            RawTxAck_fields,            (void (*)(void *))fsm_msgRawTxAck, AnyVariant)
-
-    MSG_IN(MessageType_MessageType_FlashWrite,          FlashWrite_fields, (void (*)(void *))fsm_msgFlashWrite, MFROnly)
-    MSG_IN(MessageType_MessageType_FlashHash,           FlashHash_fields, (void (*)(void *))fsm_msgFlashHash, MFROnly)
-    MSG_IN(MessageType_MessageType_SoftReset,           SoftReset_fields, (void (*)(void *))fsm_msgSoftReset, MFROnly)
-
-    /* Normal Out Messages */
-    MSG_OUT(MessageType_MessageType_Success,            Success_fields,             NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_Failure,            Failure_fields,             NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_Entropy,            Entropy_fields,             NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_PublicKey,          PublicKey_fields,           NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_Features,           Features_fields,            NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_CoinTable,          CoinTable_fields,           NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_PinMatrixRequest,   PinMatrixRequest_fields,    NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_TxRequest,          TxRequest_fields,           NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_CipheredKeyValue,   CipheredKeyValue_fields,    NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_ButtonRequest,      ButtonRequest_fields,       NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_Address,            Address_fields,             NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_EntropyRequest,     EntropyRequest_fields,      NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_MessageSignature,   MessageSignature_fields,    NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_SignedIdentity,     SignedIdentity_fields,      NO_PROCESS_FUNC, AnyVariant)
-/* ECIES disabled
-    MSG_OUT(MessageType_MessageType_EncryptedMessage,   EncryptedMessage_fields,    NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_DecryptedMessage,   DecryptedMessage_fields,    NO_PROCESS_FUNC, AnyVariant)
-*/
-    MSG_OUT(MessageType_MessageType_PassphraseRequest,  PassphraseRequest_fields,   NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_TxSize,             TxSize_fields,              NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_WordRequest,        WordRequest_fields,         NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_CharacterRequest,   CharacterRequest_fields,    NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_EthereumAddress,    EthereumAddress_fields,     NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_EthereumTxRequest,  EthereumTxRequest_fields,   NO_PROCESS_FUNC, AnyVariant)
+#include "keepkey/firmware/messagemap.def"
+};
 
-#if DEBUG_LINK
-    /* Debug Messages */
-    DEBUG_IN(MessageType_MessageType_DebugLinkDecision, DebugLinkDecision_fields,   NO_PROCESS_FUNC, AnyVariant)
-    DEBUG_IN(MessageType_MessageType_DebugLinkGetState, DebugLinkGetState_fields, (void (*)(void *))fsm_msgDebugLinkGetState, AnyVariant)
-    DEBUG_IN(MessageType_MessageType_DebugLinkStop,     DebugLinkStop_fields, (void (*)(void *))fsm_msgDebugLinkStop, AnyVariant)
-#endif
+/* Every parsable incoming message, so the decode buffer fits the largest */
+typedef union
+{
+#define MSG_IN(NAME, PROCESS_FUNC, MSG_PERMS) MSG_DECODE_MEMBER(NAME, PROCESS_FUNC, MSG_PERMS)
+#define DEBUG_IN(NAME, PROCESS_FUNC, MSG_PERMS) MSG_DECODE_MEMBER(NAME, PROCESS_FUNC, MSG_PERMS)
+#include "keepkey/firmware/messagemap.def"
+} DecodeBuffer;
 
-    MSG_IN(MessageType_MessageType_DebugLinkFlashDump,         DebugLinkFlashDump_fields, (void (*)(void *))fsm_msgDebugLinkFlashDump, MFROnly)
+_Static_assert(sizeof(DecodeBuffer) <= MAX_DECODE_SIZE,
+               "Largest incoming message exceeds MAX_DECODE_SIZE");
 
-#if DEBUG_LINK
-    /* Debug Out Messages */
-    DEBUG_OUT(MessageType_MessageType_DebugLinkState, DebugLinkState_fields,        NO_PROCESS_FUNC, AnyVariant)
-    DEBUG_OUT(MessageType_MessageType_DebugLinkLog, DebugLinkLog_fields,            NO_PROCESS_FUNC, AnyVariant)
-#endif
-
-    MSG_OUT(MessageType_MessageType_DebugLinkFlashDumpResponse, DebugLinkFlashDumpResponse_fields,    NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_FlashHashResponse, FlashHashResponse_fields,    NO_PROCESS_FUNC, AnyVariant)
-};
+static DecodeBuffer decode_buffer;
 
 extern bool reset_msg_stack;
 
@@ -326,9 +250,13 @@ static int process_ethereum_msg(EthereumSignTx *msg, bool *confirm_ptr)
 
 void fsm_init(void)
 {
-    msg_map_init(MessagesMap, sizeof(MessagesMap) / sizeof(MessagesMap_t));
+    msg_map_init(MessagesMap, sizeof(MessagesMap) / sizeof(MessagesMap_t),
+                 &decode_buffer, sizeof(decode_buffer));
     set_msg_failure_handler(&fsm_sendFailure);
 
+    /* deferred storage commits must not wait out a confirm or PIN screen */
+    set_msg_idle_handler(&storage_poll);
+
     /* set leaving handler for layout to help with determine home state */
     set_leaving_handler(&leave_home);
 
@@ -1050,7 +978,7 @@ void fsm_msgApplySettings(ApplySettings *msg)
         storage_set_passphrase_protected(msg->use_passphrase);
     }
 
-    storage_commit();
+    storage_mark_dirty();
 
     fsm_sendSuccess("Settings applied");
     go_home();
@@ -1227,6 +1155,107 @@ void fsm_msgGetAddress(GetAddress *msg)
     go_home();
 }
 
+void fsm_msgGetAddresses(GetAddresses *msg)
+{
+    RESP_INIT(Addresses);
+
+    /* The account node lives in static storage so it stays off the stack */
+    static HDNode account;
+    static HDNode children[ECDSA_BATCH_SIZE];
+    uint32_t index[ECDSA_BATCH_SIZE];
+    const size_t max_per_msg = sizeof(resp->addresses) / sizeof(resp->addresses[0]);
+
+    if (!storage_is_initialized())
+    {
+        fsm_sendFailure(FailureType_Failure_NotInitialized, "Device not initialized");
+        return;
+    }
+
+    const uint32_t start = msg->has_start ? msg->start : 0;
+    const uint32_t count = msg->has_count ? msg->count : 1;
+
+    /* Only non-hardened children can be derived from the public account node */
+    if(count == 0 || count > GET_ADDRESSES_MAX_COUNT ||
+       start >= 0x80000000 || count > 0x80000000 - start)
+    {
+        fsm_sendFailure(FailureType_Failure_SyntaxError, "Invalid address range");
+        return;
+    }
+
+    if(!pin_protect_cached())
+    {
+        go_home();
+        return;
+    }
+
+    const CoinType *coin = fsm_getCoin(msg->coin_name);
+
+    if(!coin) { return; }
+
+    HDNode *node = fsm_getDerivedNode(SECP256K1_NAME, msg->address_n, msg->address_n_count);
+
+    if(!node) { return; }
+    hdnode_fill_public_key(node);
+
+    account = *node;
+    memset(account.private_key, 0, sizeof(account.private_key));
+
+    resp->has_start = true;
+    resp->start = start;
+
+    uint32_t done = 0;
+    while(done < count)
+    {
+        uint32_t batch = count - done;
+        uint32_t i;
+
+        if(batch > ECDSA_BATCH_SIZE)
+        {
+            batch = ECDSA_BATCH_SIZE;
+        }
+
+        for(i = 0; i < batch; i++)
+        {
+            children[i] = account;
+            index[i] = start + done + i;
+        }
+
+        if(!hdnode_public_ckd_batch(children, index, batch))
+        {
+            fsm_sendFailure(FailureType_Failure_Other, "Failed to derive public key");
+            go_home();
+            return;
+        }
+
+        for(i = 0; i < batch; i++)
+        {
+            ecdsa_get_address(children[i].public_key, coin->address_type,
+                              resp->addresses[resp->addresses_count],
+                              sizeof(resp->addresses[0]));
+            resp->addresses_count++;
+
+            /* Send each full pack right away so one request streams any range */
+            if(resp->addresses_count == max_per_msg)
+            {
+                msg_write(MessageType_MessageType_Addresses, resp);
+                memset(resp, 0, sizeof(Addresses));
+                resp->has_start = true;
+                resp->start = start + done + i + 1;
+            }
+        }
+
+        done += batch;
+        animating_progress_handler();
+    }
+
+    if(resp->addresses_count)
+    {
+        msg_write(MessageType_MessageType_Addresses, resp);
+    }
+
+    go_home();
+}
+
 void fsm_msgEthereumGetAddress(EthereumGetAddress *msg)
 {
     char address[43];
@@ -1581,7 +1610,7 @@ void fsm_msgApplyPolicies(ApplyPolicies *msg)
         return;
     }
 
-    storage_commit();
+    storage_mark_dirty();
 
     fsm_sendSuccess("Policies applied");
     go_home();
@@ -1643,10 +1672,29 @@ void fsm_msgDebugLinkGetState(DebugLinkGetState *msg)
     resp->has_firmware_hash = true;
     resp->firmware_hash.size = memory_firmware_hash(resp->firmware_hash.bytes);
 
+    /* Hash what flash holds, deferred changes included */
+    storage_flush();
     resp->has_storage_hash = true;
     resp->storage_hash.size = memory_storage_hash(resp->storage_hash.bytes,
                               get_storage_location());
 
+#if USE_BIP32_CACHE
+    resp->has_bip32_cache_hits = true;
+    resp->has_bip32_cache_misses = true;
+    hdnode_private_ckd_cache_stats(&resp->bip32_cache_hits, &resp->bip32_cache_misses);
+#endif
+
+    UsbTxStats tx_stats;
+    usb_tx_stats(&tx_stats);
+    resp->has_usb_tx_depth = true;
+    resp->usb_tx_depth = tx_stats.depth;
+    resp->has_usb_tx_max_depth = true;
+    resp->usb_tx_max_depth = tx_stats.max_depth;
+    resp->has_usb_tx_stalls = true;
+    resp->usb_tx_stalls = tx_stats.stalls;
+    resp->has_usb_tx_packets = true;
+    resp->usb_tx_packets = tx_stats.packets;
+
     msg_debug_write(MessageType_MessageType_DebugLinkState, resp);
 }
 
@@ -108,6 +108,9 @@ void recovery_init(uint32_t _word_count, bool passphrase_protection, bool pin_pr
 		return;
 	}
 
+	/* Land pending settings before this session starts editing shadow memory */
+	storage_flush();
+
 	word_count = _word_count;
 	enforce_wordlist = _enforce_wordlist;
 
@@ -213,6 +216,19 @@ void recovery_abort(bool send_failure)
     }
 }
 
+/*
+ * recovery_in_progress() - Whether a word or cipher recovery is running
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether recovery settings are in shadow memory without a seed
+ */
+bool recovery_in_progress(void)
+{
+    return awaiting_word || recovery_cipher_in_progress();
+}
+
 /* === Debug Functions =========================================================== */
 
 #if DEBUG_LINK
@@ -214,6 +214,9 @@ bool attempt_auto_complete(char *partial_word)
 void recovery_cipher_init(bool passphrase_protection, bool pin_protection,
                           const char *language, const char *label, bool _enforce_wordlist)
 {
+    /* Land pending settings before this session starts editing shadow memory */
+    storage_flush();
+
     if(pin_protection && !change_pin())
     {
         go_home();
@@ -440,6 +443,19 @@ void recovery_cipher_finalize(void)
     go_home();
 }
 
+/*
+ * recovery_cipher_in_progress() - Whether a cipher recovery is running
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether characters are still expected
+ */
+bool recovery_cipher_in_progress(void)
+{
+    return awaiting_character;
+}
+
 /*
  * recovery_cipher_abort() - Aborts recovery cipher process
  *
@@ -56,6 +56,9 @@ void reset_init(bool display_random, uint32_t _strength, bool passphrase_protect
         return;
     }
 
+    /* Land pending settings before this session starts editing shadow memory */
+    storage_flush();
+
     strength = _strength;
 
     random_buffer(int_entropy, 32);
@@ -212,6 +215,19 @@ exit:
     go_home();
 }
 
+/*
+ * reset_in_progress() - Whether a reset is waiting for host entropy
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether reset settings are in shadow memory without a seed
+ */
+bool reset_in_progress(void)
+{
+    return awaiting_entropy;
+}
+
 /* === Debug Functions =========================================================== */
 
 #if DEBUG_LINK
@@ -59,6 +59,10 @@ static bool multisig_fp_set, multisig_fp_mismatch;
 static uint8_t hash_prevouts[32], hash_sequence[32],hash_outputs[32];
 static SHA256_CTX hashers[3];
 static uint8_t multisig_fp[32];
+static SHA256_CTX sighash_prefix;
+static uint8_t sighash_cache[SIGHASH_CACHE_SIZE];
+static uint32_t sighash_cache_len;
+static bool sighash_cache_valid;
 
 /* === Variables =========================================================== */
 
@@ -70,6 +74,7 @@ enum {
 	STAGE_REQUEST_3_OUTPUT,
 	STAGE_REQUEST_4_INPUT,
 	STAGE_REQUEST_4_OUTPUT,
+	STAGE_REQUEST_4_CACHED_INPUT,
 	STAGE_REQUEST_5_OUTPUT
 } signing_stage;
 static uint32_t version = 1;
@@ -79,9 +84,12 @@ enum {
 	PARSING_VERSION,
 	PARSING_INPUT_COUNT,
 	PARSING_INPUTS,
+	PARSING_INPUT_SCRIPT_LEN,
+	PARSING_INPUT_SCRIPT,
 	PARSING_OUTPUT_COUNT,
 	PARSING_OUTPUTS_VALUE,
 	PARSING_OUTPUTS,
+	PARSING_OUTPUT_SCRIPT,
 	PARSING_LOCKTIME
 } raw_tx_status;
 enum {
@@ -252,6 +260,131 @@ static void reset_parsing_buffer(uint8_t *buffer, uint8_t *buffer_index)
 	*buffer_index = 0;
 }
 
+static void init_inputs_and_outputs_check(void)
+{
+	sha256_Init(&transaction_inputs_and_outputs);
+	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&inputs_count, sizeof(inputs_count));
+	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&outputs_count, sizeof(outputs_count));
+	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&version, sizeof(version));
+	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&lock_time, sizeof(lock_time));
+}
+
+/*
+ * sighash_cache_entry() - Serialize the prevout and sequence of an input the
+ * way they appear in a legacy sighash preimage, followed by a digest of the
+ * whole input
+ *
+ * INPUT
+ *     tinput - input to serialize
+ *     out - buffer of SIGHASH_CACHE_INPUT_SIZE bytes
+ * OUTPUT
+ *     none
+ */
+static void sighash_cache_entry(const TxInputType *tinput, uint8_t *out)
+{
+	for (int i = 0; i < 32; i++) {
+		out[i] = tinput->prev_hash.bytes[31 - i];
+	}
+	memcpy(out + 32, &tinput->prev_index, 4);
+	memcpy(out + 36, &tinput->sequence, 4);
+	sha256_Raw((const uint8_t *)tinput, sizeof(TxInputType), out + 40);
+}
+
+/*
+ * sighash_cache_input() - Append an input's entry to the sighash cache, or
+ * give up on the cache once it is full
+ *
+ * INPUT
+ *     tinput - input seen in phase 1
+ * OUTPUT
+ *     none
+ */
+static void sighash_cache_input(const TxInputType *tinput)
+{
+	if (!sighash_cache_valid) {
+		return;
+	}
+	if (sighash_cache_len + SIGHASH_CACHE_INPUT_SIZE > sizeof(sighash_cache)) {
+		sighash_cache_valid = false;
+		return;
+	}
+	sighash_cache_entry(tinput, sighash_cache + sighash_cache_len);
+	sighash_cache_len += SIGHASH_CACHE_INPUT_SIZE;
+}
+
+/*
+ * sighash_cache_output() - Append a serialized output to the sighash cache,
+ * preceded by the output count for the first one, or give up on the cache
+ * once it is full
+ *
+ * INPUT
+ *     output - output as it is serialized into the transaction
+ * OUTPUT
+ *     none
+ */
+static void sighash_cache_output(const TxOutputBinType *output)
+{
+	if (!sighash_cache_valid) {
+		return;
+	}
+	/* worst case: output count, amount, script length, script */
+	if (sighash_cache_len + 5 + 8 + 5 + output->script_pubkey.size > sizeof(sighash_cache)) {
+		sighash_cache_valid = false;
+		return;
+	}
+	if (sighash_cache_len == inputs_count * SIGHASH_CACHE_INPUT_SIZE) {
+		sighash_cache_len += ser_length(outputs_count, sighash_cache + sighash_cache_len);
+	}
+	memcpy(sighash_cache + sighash_cache_len, &output->amount, 8);
+	sighash_cache_len += 8;
+	sighash_cache_len += tx_serialize_script(output->script_pubkey.size, output->script_pubkey.bytes,
+	                                         sighash_cache + sighash_cache_len);
+}
+
+/*
+ * digest_for_legacy_cached() - Compute the SIGHASH_ALL digest of input idx1
+ * from the sighash prefix midstate and the cached phase 1 data, then advance
+ * the prefix past input idx1
+ *
+ * INPUT
+ *     txinput - input idx1, with script_sig holding its scriptCode
+ *     xhash - 32 byte buffer for the digest
+ * OUTPUT
+ *     none
+ */
+static void digest_for_legacy_cached(const TxInputType *txinput, uint8_t *xhash)
+{
+	static const uint8_t empty_script = 0;
+	const uint32_t outputs_offset = inputs_count * SIGHASH_CACHE_INPUT_SIZE;
+	const uint8_t *entry = sighash_cache + idx1 * SIGHASH_CACHE_INPUT_SIZE;
+	uint32_t hash_type = SIGHASH_ALL;
+	SHA256_CTX ctx;
+
+	memcpy(&ctx, &sighash_prefix, sizeof(ctx));
+	sha256_Update(&ctx, entry, 36);
+	tx_script_hash(&ctx, txinput->script_sig.size, txinput->script_sig.bytes);
+	sha256_Update(&ctx, entry + 36, 4);
+
+	for (uint32_t i = idx1 + 1; i < inputs_count; i++) {
+		entry = sighash_cache + i * SIGHASH_CACHE_INPUT_SIZE;
+		sha256_Update(&ctx, entry, 36);
+		sha256_Update(&ctx, &empty_script, 1);
+		sha256_Update(&ctx, entry + 36, 4);
+	}
+
+	sha256_Update(&ctx, sighash_cache + outputs_offset, sighash_cache_len - outputs_offset);
+	sha256_Update(&ctx, (const uint8_t *)&lock_time, 4);
+	sha256_Update(&ctx, (const uint8_t *)&hash_type, 4);
+	sha256_Final(&ctx, xhash);
+	sha256_Raw(xhash, 32, xhash);
+
+	/* input idx1 is blank in the preimage of every later input */
+	entry = sighash_cache + idx1 * SIGHASH_CACHE_INPUT_SIZE;
+	sha256_Update(&sighash_prefix, entry, 36);
+	sha256_Update(&sighash_prefix, &empty_script, 1);
+	sha256_Update(&sighash_prefix, entry + 36, 4);
+}
+
 /* === Functions =========================================================== */
 
 /*
@@ -304,6 +437,18 @@ foreach O (idx1):
     Request O                                                         STAGE_REQUEST_5_OUTPUT
     Rewrite change address
     Return O
+
+If the blank inputs and serialized outputs of Phase1 fit in the sighash
+cache, Phase2 requests every input exactly once instead:
+foreach I (idx1):  // input to sign
+    Request I                                                         STAGE_REQUEST_4_CACHED_INPUT
+    Compare prevout and sequence of I with the cache
+    Add I to TransactionChecksum
+    If I is the last input:
+        Compare TransactionChecksum with input checksum from Phase1
+    Finish sighash of I from prefix midstate and cached inputs/outputs
+    Sign, advance prefix midstate past blank I
+    Return signed chunk
 */
 
 void send_req_1_input(void)
@@ -379,6 +524,17 @@ void send_req_4_input(void)
 	msg_write(MessageType_MessageType_TxRequest, &resp);
 }
 
+void send_req_4_cached_input(void)
+{
+	signing_stage = STAGE_REQUEST_4_CACHED_INPUT;
+	resp.has_request_type = true;
+	resp.request_type = RequestType_TXINPUT;
+	resp.has_details = true;
+	resp.details.has_request_index = true;
+	resp.details.request_index = idx1;
+	msg_write(MessageType_MessageType_TxRequest, &resp);
+}
+
 void send_req_4_output(void)
 {
 	signing_stage = STAGE_REQUEST_4_OUTPUT;
@@ -408,6 +564,25 @@ void send_req_finished(void)
 	msg_write(MessageType_MessageType_TxRequest, &resp);
 }
 
+/*
+ * send_req_first_output() - Finish the input half of phase 1 and request the
+ * first output
+ */
+static void send_req_first_output(void)
+{
+	sha256_Final(&hashers[0], hash_prevouts);
+	sha256_Raw(hash_prevouts, 32, hash_prevouts);
+	sha256_Final(&hashers[1], hash_sequence);
+	sha256_Raw(hash_sequence, 32, hash_sequence);
+	sha256_Final(&hashers[2], hash_check);
+
+	sha256_Init(&hashers[0]);
+
+	idx1 = 0;
+	idx2 = 0;
+	send_req_3_output();
+}
+
 void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinType *_coin, const HDNode *_root, uint32_t _version, uint32_t _lock_time)
 {
 	inputs_count = _inputs_count;
@@ -430,11 +605,10 @@ void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinTyp
 	multisig_fp_mismatch = false;
 
 	tx_init(&to, inputs_count, outputs_count, version, lock_time, false);
-	sha256_Init(&transaction_inputs_and_outputs);
-	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&inputs_count, sizeof(inputs_count));
-	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&outputs_count, sizeof(outputs_count));
-	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&version, sizeof(version));
-	sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&lock_time, sizeof(lock_time));
+	init_inputs_and_outputs_check();
+
+	sighash_cache_len = 0;
+	sighash_cache_valid = outputs_count > 0;
 
 	sha256_Init(&hashers[0]);
 	sha256_Init(&hashers[1]);
@@ -446,166 +620,262 @@ void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinTyp
     set_exchange_error(NO_EXCHANGE_ERROR);
 }
 
-void parse_raw_txack(uint8_t *msg, uint32_t msg_size){
-	static int32_t state_pos = 0;
+/*
+ * parse_raw_txack() - Stream a chunk of a raw previous transaction
+ *
+ * Fixed size fields and script bodies are consumed as whole spans, and each
+ * chunk is fed to the transaction hash with a single update, so large parent
+ * transactions cost little more than hashing them.
+ *
+ * INPUT
+ *     msg - chunk of the serialized transaction
+ *     msg_size - length of the chunk
+ * OUTPUT
+ *     none
+ */
+void parse_raw_txack(uint8_t *msg, uint32_t msg_size)
+{
 	static uint8_t *ptr;
+	static uint32_t span;
 	static uint8_t var_int_buffer[VAR_INT_BUFFER];
 	static uint8_t var_int_buffer_index;
-	static uint32_t seen, script_len;
+	static uint32_t seen, var_int;
 	static uint64_t current_output_val;
 
-	for(uint32_t i = 0; i < msg_size; ++i) {
+	uint32_t i = 0;
 
-		state_pos--;
+	if (!signing) {
+		return;
+	}
 
-		switch(raw_tx_status) {
-			case NOT_PARSING:
-				tx_init(&transaction_previous, 0, 0, 0, 0, false);
-				state_pos = sizeof(uint32_t);
-				raw_tx_status = PARSING_VERSION;
-				ptr = (uint8_t *)&transaction_previous.version;
-				FALLTHROUGH;
-			case PARSING_VERSION:
-				*ptr++ = msg[i];
+	if (raw_tx_status == NOT_PARSING) {
+		tx_init(&transaction_previous, 0, 0, 0, 0, false);
+		reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
+		raw_tx_status = PARSING_VERSION;
+		ptr = (uint8_t *)&transaction_previous.version;
+		span = 4;
+	}
 
-				if(state_pos == 1)
-				{
-					raw_tx_status = PARSING_INPUT_COUNT;
+	for (;;) {
+		bool complete;
+
+		switch (raw_tx_status) {
+			case PARSING_INPUT_COUNT:
+			case PARSING_INPUT_SCRIPT_LEN:
+			case PARSING_OUTPUT_COUNT:
+			case PARSING_OUTPUTS:
+				/* var ints are consumed byte by byte */
+				if (i == msg_size) {
+					complete = false;
+					break;
+				}
+				var_int_buffer[var_int_buffer_index++] = msg[i++];
+				if (var_int_buffer[0] == 0xff) {
+					/* 64 bit lengths do not fit in var_int_buffer */
+					raw_tx_status = NOT_PARSING;
+					fsm_sendFailure(FailureType_Failure_Other, "Unsupported varint length");
+					signing_abort();
+					return;
+				}
+				complete = var_int_buffer_index >= deser_length(var_int_buffer, &var_int);
+				if (complete) {
 					reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
 				}
 				break;
-			case PARSING_INPUT_COUNT:
-				var_int_buffer[var_int_buffer_index++] = msg[i];
-
-				if(var_int_buffer_index >= deser_length(var_int_buffer, &transaction_previous.inputs_len))
-				{
-					raw_tx_status = PARSING_INPUTS;
-					state_pos = 36;
-					seen = 0;
-					reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
+			default:
+				/* fixed size fields and scripts are consumed as spans */
+				if (span > 0 && i < msg_size) {
+					uint32_t n = msg_size - i < span ? msg_size - i : span;
+					if (ptr) {
+						memcpy(ptr, msg + i, n);
+						ptr += n;
+					}
+					i += n;
+					span -= n;
 				}
-
+				complete = span == 0;
 				break;
-			case PARSING_INPUTS:
-				if(state_pos < 0 && seen < transaction_previous.inputs_len)
-				{
-					var_int_buffer[var_int_buffer_index++] = msg[i];
-
-					if(var_int_buffer_index >= deser_length(var_int_buffer, &script_len))
-					{
-						seen++;
+		}
 
-						if(seen < transaction_previous.inputs_len)
-						{
-							state_pos = script_len + 4 + 36;
-						}
-						else
-						{
-							state_pos = script_len + 3;	
-						}
+		if (!complete) {
+			if (i == msg_size) {
+				/* current field continues in the next chunk */
+				break;
+			}
+			continue;
+		}
 
-						script_len = 0;
-						reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
-					}
-				}
-				else if(state_pos < 0)
-				{
-					raw_tx_status = PARSING_OUTPUT_COUNT;
-				}
+		/* current field is complete, set up the next one */
+		ptr = NULL;
+		switch (raw_tx_status) {
+			case PARSING_VERSION:
+				raw_tx_status = PARSING_INPUT_COUNT;
+				break;
+			case PARSING_INPUT_COUNT:
+				transaction_previous.inputs_len = var_int;
+				seen = 0;
+				raw_tx_status = var_int ? PARSING_INPUTS : PARSING_OUTPUT_COUNT;
+				span = 36;
+				break;
+			case PARSING_INPUTS:
+				raw_tx_status = PARSING_INPUT_SCRIPT_LEN;
+				break;
+			case PARSING_INPUT_SCRIPT_LEN:
+				/* script and sequence */
+				raw_tx_status = PARSING_INPUT_SCRIPT;
+				span = var_int + 4;
+				break;
+			case PARSING_INPUT_SCRIPT:
+				seen++;
+				raw_tx_status = seen < transaction_previous.inputs_len ? PARSING_INPUTS : PARSING_OUTPUT_COUNT;
+				span = 36;
 				break;
 			case PARSING_OUTPUT_COUNT:
-				var_int_buffer[var_int_buffer_index++] = msg[i];
-
-				if(var_int_buffer_index >= deser_length(var_int_buffer, &transaction_previous.outputs_len))
-				{
+				transaction_previous.outputs_len = var_int;
+				seen = 0;
+				if (var_int) {
 					raw_tx_status = PARSING_OUTPUTS_VALUE;
-					state_pos = 8;
-					seen = 0;
 					current_output_val = 0;
 					ptr = (uint8_t *)&current_output_val;
-					reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
+					span = 8;
+				} else {
+					raw_tx_status = PARSING_LOCKTIME;
+					ptr = (uint8_t *)&transaction_previous.lock_time;
+					span = 4;
 				}
 				break;
 			case PARSING_OUTPUTS_VALUE:
-				if(state_pos < 8)
-				{
-					*ptr++ = msg[i];
-
-					if(state_pos < 1)
-					{
-						if (seen == input.prev_index) {
-							to_spend += current_output_val;
-						}
-
-						raw_tx_status = PARSING_OUTPUTS;
-						script_len = 0;
-						reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
-					}
+				if (seen == input.prev_index) {
+					to_spend += current_output_val;
 				}
+				raw_tx_status = PARSING_OUTPUTS;
 				break;
 			case PARSING_OUTPUTS:
-				if(state_pos < 0 && seen < transaction_previous.outputs_len)
-				{
-					var_int_buffer[var_int_buffer_index++] = msg[i];
-
-					if(var_int_buffer_index >= deser_length(var_int_buffer, &script_len))
-					{
-						seen++;
-
-						if(seen < transaction_previous.outputs_len)
-						{
-							current_output_val = 0;
-							ptr = (uint8_t *)&current_output_val;
-							raw_tx_status = PARSING_OUTPUTS_VALUE;
-							state_pos = script_len + 8;
-						}
-						else
-						{
-							state_pos = script_len - 1;
-						}
-					}
-				}
-				else if(state_pos < 0)
-				{
+				raw_tx_status = PARSING_OUTPUT_SCRIPT;
+				span = var_int;
+				break;
+			case PARSING_OUTPUT_SCRIPT:
+				seen++;
+				if (seen < transaction_previous.outputs_len) {
+					raw_tx_status = PARSING_OUTPUTS_VALUE;
+					current_output_val = 0;
+					ptr = (uint8_t *)&current_output_val;
+					span = 8;
+				} else {
 					raw_tx_status = PARSING_LOCKTIME;
-					state_pos = 4;
 					ptr = (uint8_t *)&transaction_previous.lock_time;
-					reset_parsing_buffer(var_int_buffer, &var_int_buffer_index);
+					span = 4;
 				}
 				break;
+			case NOT_PARSING:
+				break;
 			case PARSING_LOCKTIME:
-            	if(state_pos >= 0)
-				{
-					*ptr++ = msg[i];
-				}
-				if(state_pos < 1)
-				{
-					raw_tx_status = NOT_PARSING;
-					memset(&resp, 0, sizeof(TxRequest));
-
-					sha256_Update(&(transaction_previous.ctx), (const uint8_t*)msg+i, 1);
-					tx_hash_final(&transaction_previous, hash, true);
-					if (memcmp(hash, input.prev_hash.bytes, 32) != 0) {
-						fsm_sendFailure(FailureType_Failure_Other, "Encountered invalid prevhash");
-						signing_abort();
-						return;
-					}
-            		
-            		if (idx1 < inputs_count - 1) {
-						idx1++;
-						send_req_1_input();
-					} else {
-						idx1 = 0;
-						send_req_3_output();
-					}
+				raw_tx_status = NOT_PARSING;
+				memset(&resp, 0, sizeof(TxRequest));
 
+				sha256_Update(&(transaction_previous.ctx), msg, i);
+				tx_hash_final(&transaction_previous, hash, true);
+				if (memcmp(hash, input.prev_hash.bytes, 32) != 0) {
+					fsm_sendFailure(FailureType_Failure_Other, "Encountered invalid prevhash");
+					signing_abort();
 					return;
 				}
-				break;
+
+				if (idx1 < inputs_count - 1) {
+					idx1++;
+					send_req_1_input();
+				} else {
+					send_req_first_output();
+				}
+				return;
 		}
+	}
+
+	sha256_Update(&(transaction_previous.ctx), msg, i);
+}
 
-		sha256_Update(&(transaction_previous.ctx), (const uint8_t*)msg+i, 1);
+/*
+ * signing_sign_input() - Sign input idx1 and serialize it into resp
+ *
+ * INPUT
+ *     cached - true to finish the sighash from the sighash cache, false to use
+ *              the digest streamed through transaction_input_sig_digest
+ * OUTPUT
+ *     true/false status; on failure the signing session has been aborted
+ */
+static bool signing_sign_input(bool cached)
+{
+	uint8_t sighash;
+	if (coin->has_forkid) {
+		if (!compile_input_script_sig(&input)) {
+			fsm_sendFailure(FailureType_Failure_Other, ("Processor Error: Failed to compile input"));
+			signing_abort();
+			return false;
+		}
+		if (!input.has_amount) {
+			fsm_sendFailure(FailureType_Failure_Other, ("Data Error: input without amount"));
+			signing_abort();
+			return false;
+		}
+		if (input.amount > to_spend) {
+			fsm_sendFailure(FailureType_Failure_Other, ("Data Error: Transaction has changed during signing"));
+			signing_abort();
+			return false;
+		}
+		to_spend -= input.amount;
+		memcpy(privkey, node.private_key, 32);
+		memcpy(pubkey, node.public_key, 33);
+		sighash = SIGHASH_ALL | SIGHASH_FORKID;
+		digest_for_bip143(&input, sighash, coin->forkid, hash);
+	} else if (cached) {
+		if (!compile_input_script_sig(&input)) {
+			fsm_sendFailure(FailureType_Failure_Other, "Failed to compile input");
+			signing_abort();
+			return false;
+		}
+		memcpy(privkey, node.private_key, 32);
+		memcpy(pubkey, node.public_key, 33);
+		sighash = SIGHASH_ALL;
+		digest_for_legacy_cached(&input, hash);
+	} else {
+		sighash = SIGHASH_ALL;
+		tx_hash_final(&transaction_input_sig_digest, hash, false);
+	}
+	resp.has_serialized = true;
+	resp.serialized.has_signature_index = true;
+	resp.serialized.signature_index = idx1;
+	resp.serialized.has_signature = true;
+	resp.serialized.has_serialized_tx = true;
+	ecdsa_sign_digest(&secp256k1, privkey, hash, sig, 0);
+	resp.serialized.signature.size = ecdsa_sig_to_der(sig, resp.serialized.signature.bytes);
+	if (input.script_type == InputScriptType_SPENDMULTISIG) {
+		if (!input.has_multisig) {
+			fsm_sendFailure(FailureType_Failure_Other, "Multisig info not provided");
+			signing_abort();
+			return false;
+		}
+		// fill in the signature
+		int pubkey_idx = cryptoMultisigPubkeyIndex(&(input.multisig), pubkey);
+		if (pubkey_idx < 0) {
+			fsm_sendFailure(FailureType_Failure_Other, "Pubkey not found in multisig script");
+			signing_abort();
+			return false;
+		}
+		memcpy(input.multisig.signatures[pubkey_idx].bytes, resp.serialized.signature.bytes, resp.serialized.signature.size);
+		input.multisig.signatures[pubkey_idx].size = resp.serialized.signature.size;
+		input.script_sig.size = serialize_script_multisig(&(input.multisig), input.script_sig.bytes);
+		if (input.script_sig.size == 0) {
+			fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize multisig script");
+			signing_abort();
+			return false;
+		}
+	} else { // SPENDADDRESS
+		input.script_sig.size = serialize_script_sig(
+				resp.serialized.signature.bytes, resp.serialized.signature.size,
+				pubkey, 33, sighash, input.script_sig.bytes);
 	}
+	resp.serialized.serialized_tx.size = tx_serialize_input(&to, &input, resp.serialized.serialized_tx.bytes);
+	return true;
 }
 
 void signing_txack(TransactionType *tx)
@@ -649,6 +919,7 @@ void signing_txack(TransactionType *tx)
 				multisig_fp_mismatch = true;
 			}
 			sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)tx->inputs, sizeof(TxInputType));
+			sighash_cache_input(tx->inputs);
 			memcpy(&input, tx->inputs, sizeof(TxInputType));
 
 			TxInputType *txinput = &tx->inputs[0];
@@ -707,17 +978,7 @@ void signing_txack(TransactionType *tx)
 					idx1++;
 					send_req_1_input();
 				} else {
-					sha256_Final(&hashers[0], hash_prevouts);
-					sha256_Raw(hash_prevouts, 32, hash_prevouts);
-					sha256_Final(&hashers[1], hash_sequence);
-					sha256_Raw(hash_sequence, 32, hash_sequence);
-					sha256_Final(&hashers[2], hash_check);
-
-					sha256_Init(&hashers[0]);
-
-					idx1 = 0;
-					idx2 = 0;
-					send_req_3_output();
+					send_req_first_output();
 				}
 			}
 			return;
@@ -783,6 +1044,7 @@ void signing_txack(TransactionType *tx)
 			sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&bin_output, sizeof(TxOutputBinType));
 
 			tx_output_hash(&hashers[0], &bin_output);
+			sighash_cache_output(&bin_output);
 
 			if (idx1 < outputs_count - 1) {
 				idx1++;
@@ -829,18 +1091,21 @@ void signing_txack(TransactionType *tx)
 				sha256_Final(&hashers[0], hash_outputs);
 				sha256_Raw(hash_outputs, 32, hash_outputs);
 
-			    send_req_4_input();
+				if (sighash_cache_valid) {
+					sha256_Init(&sighash_prefix);
+					sha256_Update(&sighash_prefix, (const uint8_t *)&version, 4);
+					ser_length_hash(&sighash_prefix, inputs_count);
+					send_req_4_cached_input();
+				} else {
+					send_req_4_input();
+				}
 			}
 			return;
 		}
 		case STAGE_REQUEST_4_INPUT:
 			if (idx2 == 0) {
 				tx_init(&transaction_input_sig_digest, inputs_count, outputs_count, version, lock_time, true);
-				sha256_Init(&transaction_inputs_and_outputs);
-				sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&inputs_count, sizeof(inputs_count));
-				sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&outputs_count, sizeof(outputs_count));
-				sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&version, sizeof(version));
-				sha256_Update(&transaction_inputs_and_outputs, (const uint8_t *)&lock_time, sizeof(lock_time));
+				init_inputs_and_outputs_check();
 				memset(privkey, 0, 32);
 				memset(pubkey, 0, 33);
 			}
@@ -895,64 +1160,9 @@ void signing_txack(TransactionType *tx)
 					return;
 				}
 
-				uint8_t sighash;
-				if (coin->has_forkid) {
-					if (!compile_input_script_sig(&input)) {
-						fsm_sendFailure(FailureType_Failure_Other, ("Processor Error: Failed to compile input"));
-						signing_abort();
-						return;
-					}
-					if (!input.has_amount) {
-						fsm_sendFailure(FailureType_Failure_Other, ("Data Error: input without amount"));
-						signing_abort();
-						return;
-					}
-					if (input.amount > to_spend) {
-						fsm_sendFailure(FailureType_Failure_Other, ("Data Error: Transaction has changed during signing"));
-						signing_abort();
-						return;
-					}
-					to_spend -= input.amount;
-					sighash = SIGHASH_ALL | SIGHASH_FORKID;
-					digest_for_bip143(&input, sighash, coin->forkid, hash);
-				} else {
-					sighash = SIGHASH_ALL;
-					tx_hash_final(&transaction_input_sig_digest, hash, false);
-				}
-				resp.has_serialized = true;
-				resp.serialized.has_signature_index = true;
-				resp.serialized.signature_index = idx1;
-				resp.serialized.has_signature = true;
-				resp.serialized.has_serialized_tx = true;
-				ecdsa_sign_digest(&secp256k1, privkey, hash, sig, 0);
-				resp.serialized.signature.size = ecdsa_sig_to_der(sig, resp.serialized.signature.bytes);
-				if (input.script_type == InputScriptType_SPENDMULTISIG) {
-					if (!input.has_multisig) {
-						fsm_sendFailure(FailureType_Failure_Other, "Multisig info not provided");
-						signing_abort();
-						return;
-					}
-					// fill in the signature
-					int pubkey_idx = cryptoMultisigPubkeyIndex(&(input.multisig), pubkey);
-					if (pubkey_idx < 0) {
-						fsm_sendFailure(FailureType_Failure_Other, "Pubkey not found in multisig script");
-						signing_abort();
-						return;
-					}
-					memcpy(input.multisig.signatures[pubkey_idx].bytes, resp.serialized.signature.bytes, resp.serialized.signature.size);
-					input.multisig.signatures[pubkey_idx].size = resp.serialized.signature.size;
-					input.script_sig.size = serialize_script_multisig(&(input.multisig), input.script_sig.bytes);
-					if (input.script_sig.size == 0) {
-						fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize multisig script");
-						signing_abort();
-						return;
-					}
-				} else { // SPENDADDRESS
-					input.script_sig.size = serialize_script_sig(
-							resp.serialized.signature.bytes, resp.serialized.signature.size,
-							pubkey, 33, sighash, input.script_sig.bytes);
+				if (!signing_sign_input(false)) {
+					return;
 				}
-				resp.serialized.serialized_tx.size = tx_serialize_input(&to, &input, resp.serialized.serialized_tx.bytes);
 
 				if (idx1 < inputs_count - 1) {
 					idx1++;
@@ -964,6 +1174,29 @@ void signing_txack(TransactionType *tx)
 				}
 			}
 			return;
+		case STAGE_REQUEST_4_CACHED_INPUT:
+		{
+			uint8_t entry[SIGHASH_CACHE_INPUT_SIZE];
+			/* the whole input must match phase 1 before it is signed */
+			sighash_cache_entry(&tx->inputs[0], entry);
+			if (memcmp(entry, sighash_cache + idx1 * SIGHASH_CACHE_INPUT_SIZE, SIGHASH_CACHE_INPUT_SIZE) != 0) {
+				fsm_sendFailure(FailureType_Failure_Other, "Transaction has changed during signing");
+				signing_abort();
+				return;
+			}
+			memcpy(&input, tx->inputs, sizeof(TxInputType));
+			if (!signing_sign_input(true)) {
+				return;
+			}
+			if (idx1 < inputs_count - 1) {
+				idx1++;
+				send_req_4_cached_input();
+			} else {
+				idx1 = 0;
+				send_req_5_output();
+			}
+			return;
+		}
 		case STAGE_REQUEST_5_OUTPUT:
 			co = run_policy_compile_output(coin, root, (void *)tx->outputs, (void *)&bin_output, false);
 			if (co <= TXOUT_COMPILE_ERROR) {
@@ -23,6 +23,8 @@
 
 #ifndef EMULATOR
 #  include <libopencm3/stm32/flash.h>
+#else
+#  include "keepkey/board/flash_sim.h"
 #endif
 
 #include "keepkey/board/keepkey_board.h"
@@ -30,6 +32,7 @@
 #include "keepkey/board/memory.h"
 #include "keepkey/board/variant.h"
 #include "keepkey/crypto/aes.h"
+#include "keepkey/crypto/bip32.h"
 #include "keepkey/crypto/bip39.h"
 #include "keepkey/crypto/curves.h"
 #include "keepkey/crypto/macros.h"
@@ -37,14 +40,24 @@
 #include "keepkey/firmware/fsm.h"
 #include "keepkey/firmware/passphrase_sm.h"
 #include "keepkey/firmware/policy.h"
+#include "keepkey/firmware/recovery.h"
+#include "keepkey/firmware/reset.h"
 #include "keepkey/firmware/storagepb.h"
+#include "keepkey/firmware/storage_log.h"
 #include "keepkey/firmware/util.h"
 #include "keepkey/rand/rng.h"
 #include "keepkey/transport/interface.h"
 
+#include <stddef.h>
 #include <string.h>
 #include <stdint.h>
 
+/* Log records start after the snapshot, on a word boundary */
+#define STORAGE_LOG_START       ((sizeof(ConfigFlash) + 3) & ~3)
+
+/* Changes that do not fit one record rewrite the sector instead */
+#define STORAGE_LOG_RECORD_MAX  512
+
 static bool sessionSeedCached, sessionSeedUsesPassphrase;
 static uint8_t CONFIDENTIAL sessionSeed[64];
 
@@ -56,12 +69,42 @@ static char CONFIDENTIAL sessionPassphrase[51];
 
 static Allocation storage_location = FLASH_INVALID;
 
+/* Changes waiting for a deferred commit, and whether its delay has run out */
+static bool storage_dirty;
+static volatile bool storage_commit_due;
+
 /* === Variables =========================================================== */
 
 /* Shadow memory for configuration data in storage partition */
 _Static_assert(sizeof(ConfigFlash) <= FLASH_STORAGE_LEN, "ConfigFlash struct is too large for storage partition");
 static ConfigFlash CONFIDENTIAL shadow_config;
 
+/* Configuration as flash holds it, which commits are diffed against */
+static ConfigFlash CONFIDENTIAL flash_config;
+
+/* Offset of the next log record in the active sector, or 0 when the
+   sector has to be rewritten before anything can be appended */
+static size_t storage_log_end;
+
+static uint32_t CONFIDENTIAL storage_log_record[STORAGE_LOG_RECORD_MAX / sizeof(uint32_t)];
+
+_Static_assert(sizeof(ConfigFlash) <= UINT16_MAX, "log segment offsets are 16 bit");
+_Static_assert(STORAGE_LOG_START + STORAGE_LOG_RECORD_MAX <= FLASH_STORAGE_LEN,
+               "storage sector has no room for a log");
+
+/* Fields whose old values must not stay readable in flash once changed */
+static const struct
+{
+    size_t offset;
+    size_t len;
+} storage_secrets[] =
+{
+    { offsetof(ConfigFlash, storage.node), sizeof(((ConfigFlash *)NULL)->storage.node) },
+    { offsetof(ConfigFlash, storage.mnemonic), sizeof(((ConfigFlash *)NULL)->storage.mnemonic) },
+    { offsetof(ConfigFlash, storage.pin), sizeof(((ConfigFlash *)NULL)->storage.pin) },
+    { offsetof(ConfigFlash, cache), sizeof(((ConfigFlash *)NULL)->cache) },
+};
+
 /* === Private Functions =================================================== */
 
 /*
@@ -152,6 +195,7 @@ static bool storage_from_flash(ConfigFlash *stor_config)
         case StorageVersion_8:
         case StorageVersion_9:
         case StorageVersion_10:
+            /* Snapshot only; the first commit rewrites it with room for a log */
             memcpy(&shadow_config, stor_config, sizeof(shadow_config));
 
             /* We have to do this for users with bootloaders <= v1.0.2. This
@@ -167,6 +211,24 @@ static bool storage_from_flash(ConfigFlash *stor_config)
             shadow_config.storage.version = STORAGE_VERSION;
             return true;
 
+        case StorageVersion_11:
+        {
+            size_t log_len;
+
+            memcpy(&shadow_config, stor_config, sizeof(shadow_config));
+
+            if(storage_log_replay((const uint8_t *)stor_config + STORAGE_LOG_START,
+                                  FLASH_STORAGE_LEN - STORAGE_LOG_START,
+                                  (uint8_t *)&shadow_config, sizeof(shadow_config),
+                                  &log_len))
+            {
+                storage_log_end = STORAGE_LOG_START + log_len;
+            }
+
+            memcpy(&flash_config, &shadow_config, sizeof(flash_config));
+            return true;
+        }
+
         case StorageVersion_NONE:
             return false;
 
@@ -224,6 +286,160 @@ static void wear_leveling_shift(void)
     }
 }
 
+/*
+ * storage_secrets_changed() - Whether a commit overwrites a secret
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether any secret differs from flash
+ *
+ */
+static bool storage_secrets_changed(void)
+{
+    for(size_t i = 0; i < sizeof(storage_secrets) / sizeof(storage_secrets[0]); i++)
+    {
+        if(memcmp((const uint8_t *)&shadow_config + storage_secrets[i].offset,
+                  (const uint8_t *)&flash_config + storage_secrets[i].offset,
+                  storage_secrets[i].len) != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * storage_append() - Commit changes by appending one record to the log in
+ * the active sector
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether the changes are in flash; false when the sector
+ *     has to be rewritten instead
+ *
+ */
+static bool storage_append(void)
+{
+    size_t record_len;
+    bool ret_stat;
+
+    if(storage_log_end == 0 || storage_secrets_changed() ||
+            !storage_log_encode(storage_log_record, sizeof(storage_log_record),
+                                (const uint8_t *)&flash_config,
+                                (const uint8_t *)&shadow_config,
+                                sizeof(shadow_config), &record_len) ||
+            storage_log_end + record_len > FLASH_STORAGE_LEN)
+    {
+        return false;
+    }
+
+    if(record_len == 0)
+    {
+        return true;
+    }
+
+    /* flash_write_word() reads every word back */
+    flash_unlock();
+    ret_stat = flash_chk_status() &&
+               flash_write_word(storage_location, storage_log_end, record_len,
+                                (uint8_t *)storage_log_record);
+    flash_lock();
+
+    memset(storage_log_record, 0, sizeof(storage_log_record));
+
+    if(!ret_stat)
+    {
+        /* A partial record can't be appended after; rewrite the sector */
+        storage_log_end = 0;
+        return false;
+    }
+
+    memcpy(&flash_config, &shadow_config, sizeof(flash_config));
+    storage_log_end += record_len;
+    return true;
+}
+
+/*
+ * storage_compact() - Rewrite the whole configuration into the next sector,
+ * leaving an empty log after it
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+static void storage_compact(void)
+{
+    uint32_t retries;
+
+    for(retries = 0; retries < STORAGE_RETRIES; retries++)
+    {
+        /* Make sure flash is in good state before proceeding */
+        if(!flash_chk_status())
+        {
+            flash_clear_status_flags();
+            continue; /* Retry */
+        }
+
+        /* Make sure storage sector is valid before proceeding */
+        if(storage_location < FLASH_STORAGE1 && storage_location > FLASH_STORAGE3)
+        {
+            /* Let it exhaust the retries and error out */
+            continue;
+        }
+
+        flash_unlock();
+        flash_erase_word(storage_location);
+        wear_leveling_shift();
+
+
+        flash_erase_word(storage_location);
+
+        /* Load storage data first before loading storage magic.  Both
+           writes read back what they program, so success means verified. */
+        if(flash_write_word(storage_location, STORAGE_MAGIC_LEN,
+                            sizeof(shadow_config) - STORAGE_MAGIC_LEN,
+                            (uint8_t *)&shadow_config + STORAGE_MAGIC_LEN) &&
+                flash_write_word(storage_location, 0, STORAGE_MAGIC_LEN,
+                                 (uint8_t *)&shadow_config))
+        {
+            /* Commit successful, break to exit */
+            break;
+        }
+    }
+
+    flash_lock();
+
+    if(retries >= STORAGE_RETRIES)
+    {
+        layout_warning_static("Error Detected.  Reboot Device!");
+        shutdown();
+    }
+
+    memcpy(&flash_config, &shadow_config, sizeof(flash_config));
+    storage_log_end = STORAGE_LOG_START;
+}
+
+/*
+ * storage_commit_timeout() - Deferred commit delay has run out.  Runs from
+ * the timer interrupt, so the commit itself is left to storage_poll().
+ *
+ * INPUT
+ *     - context: unused
+ * OUTPUT
+ *     none
+ *
+ */
+static void storage_commit_timeout(void *context)
+{
+    (void)context;
+    storage_commit_due = true;
+}
+
 /*
  * storage_set_root_seed_cache() - Sets root session seed  in storage
  *
@@ -304,6 +520,8 @@ storage_get_root_seed_cache_exit:
  */
 void storage_init(void)
 {
+    storage_log_end = 0;
+
     if (strcmp("MFR", variant_getName()) == 0)
     {
         // Storage should have been wiped due to the MANUFACTURER firmware
@@ -426,6 +644,10 @@ void session_clear(bool clear_pin)
     sessionPassphraseCached = false;
     memset(&sessionPassphrase, 0, sizeof(sessionPassphrase));
 
+#if USE_BIP32_CACHE
+    hdnode_private_ckd_cache_clear();
+#endif
+
     if(clear_pin)
     {
         sessionPinCached = false;
@@ -443,84 +665,71 @@ void session_clear(bool clear_pin)
  */
 void storage_commit(void)
 {
-    // TODO: implemelnt storage on the emulator
-#ifndef EMULATOR
-    uint32_t shadow_ram_crc32, shadow_flash_crc32, retries;
+    /* Everything in shadow memory goes out, deferred changes included */
+    remove_runnable(&storage_commit_timeout);
+    storage_dirty = false;
+    storage_commit_due = false;
 
     memcpy((void *)&shadow_config, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
 
-    for(retries = 0; retries < STORAGE_RETRIES; retries++)
+    /* Small changes go to the log; the sector is only rewritten when the
+       log is full or a secret changes */
+    if(!storage_append())
     {
-        /* Capture CRC for verification at restore */
-        shadow_ram_crc32 = calc_crc32((uint32_t *)&shadow_config,
-                                      sizeof(shadow_config) / sizeof(uint32_t));
-
-        if(shadow_ram_crc32 == 0)
-        {
-            continue; /* Retry */
-        }
-
-        /* Make sure flash is in good state before proceeding */
-        if(!flash_chk_status())
-        {
-            flash_clear_status_flags();
-            continue; /* Retry */
-        }
-
-        /* Make sure storage sector is valid before proceeding */
-        if(storage_location < FLASH_STORAGE1 && storage_location > FLASH_STORAGE3)
-        {
-            /* Let it exhaust the retries and error out */
-            continue;
-        }
-
-        flash_unlock();
-        flash_erase_word(storage_location);
-        wear_leveling_shift();
-
-
-        flash_erase_word(storage_location);
+        storage_compact();
+    }
+}
 
-        /* Load storage data first before loading storage magic  */
-        if(flash_write_word(storage_location, STORAGE_MAGIC_LEN,
-                            sizeof(shadow_config) - STORAGE_MAGIC_LEN,
-                            (uint8_t *)&shadow_config + STORAGE_MAGIC_LEN))
-        {
-            if(!flash_write_word(storage_location, 0, STORAGE_MAGIC_LEN,
-                                 (uint8_t *)&shadow_config))
-            {
-                continue; /* Retry */
-            }
-        }
-        else
-        {
-            continue; /* Retry */
-        }
+/*
+ * storage_mark_dirty() - Commit shadow memory a little later, so a reply can
+ * go out first and a burst of changes costs one commit
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_mark_dirty(void)
+{
+    storage_dirty = true;
 
-        /* Flash write completed successfully.  Verify CRC */
-        shadow_flash_crc32 = calc_crc32((uint32_t *)flash_write_helper(
-                                            storage_location),
-                                        sizeof(shadow_config) / sizeof(uint32_t));
+    /* Reposting restarts the delay */
+    post_delayed(&storage_commit_timeout, NULL, STORAGE_COMMIT_DELAY_MS);
+}
 
-        if(shadow_flash_crc32 == shadow_ram_crc32)
-        {
-            /* Commit successful, break to exit */
-            break;
-        }
-        else
-        {
-            continue; /* Retry */
-        }
+/*
+ * storage_flush() - Barrier: commit any deferred changes now.  Call before
+ * anything that reads storage back from flash or may lose RAM.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_flush(void)
+{
+    if(storage_dirty)
+    {
+        storage_commit();
     }
+}
 
-    flash_lock();
-
-    if(retries >= STORAGE_RETRIES)
+/*
+ * storage_poll() - Run a deferred commit whose delay has run out.  Called
+ * from the main loop.  Held back while a reset or recovery has its settings
+ * in shadow memory but no seed yet; that session commits or drops them.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_poll(void)
+{
+    if(storage_commit_due && !reset_in_progress() && !recovery_in_progress())
     {
-        layout_warning_static("Error Detected.  Reboot Device!");
-        shutdown();
+        storage_flush();
     }
-#endif
 }
 
 void storage_dumpNode(HDNodeType *dst, const StorageHDNode *src) {
@@ -568,6 +777,7 @@ void storage_dumpNode(HDNodeType *dst, const StorageHDNode *src) {
  */
 void storage_load_device(LoadDevice *msg)
 {
+    storage_flush();
     storage_reset();
 
     shadow_config.storage.has_imported = true;
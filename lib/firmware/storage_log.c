@@ -0,0 +1,233 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/firmware/storage_log.h"
+
+#include "keepkey/board/keepkey_board.h"
+
+#include <string.h>
+
+/* === Private Functions =================================================== */
+
+/*
+ * storage_log_padded() - Size of a record in flash
+ *
+ * INPUT
+ *     - len: bytes of segments in the record
+ * OUTPUT
+ *     record size rounded up to a whole word
+ */
+static size_t storage_log_padded(size_t len)
+{
+    return((sizeof(StorageLogRecord) + len + 3) & ~(size_t)3);
+}
+
+/*
+ * storage_log_crc() - CRC of a record, covering everything after the crc
+ * field, padding included
+ *
+ * INPUT
+ *     - record: word-aligned record
+ * OUTPUT
+ *     crc32
+ */
+static uint32_t storage_log_crc(const StorageLogRecord *record)
+{
+    return(calc_crc32((uint32_t *)&record->crc + 1,
+                      (storage_log_padded(record->len) - sizeof(record->crc)) /
+                      sizeof(uint32_t)));
+}
+
+/*
+ * storage_log_apply() - Walk the segments of a record
+ *
+ * INPUT
+ *     - segments: first segment
+ *     - len: bytes of segments
+ *     - config: configuration to patch, or NULL to only check the bounds
+ *     - config_len: size of configuration
+ * OUTPUT
+ *     true/false whether every segment lies within the configuration
+ */
+static bool storage_log_apply(const uint8_t *segments, size_t len, uint8_t *config,
+                              size_t config_len)
+{
+    size_t pos = 0;
+
+    while(pos < len)
+    {
+        StorageLogSegment seg;
+
+        if(len - pos < sizeof(seg))
+        {
+            return(false);
+        }
+
+        memcpy(&seg, segments + pos, sizeof(seg));
+        pos += sizeof(seg);
+
+        if(seg.len > len - pos || seg.offset + seg.len > config_len)
+        {
+            return(false);
+        }
+
+        if(config)
+        {
+            memcpy(config + seg.offset, segments + pos, seg.len);
+        }
+
+        pos += seg.len;
+    }
+
+    return(true);
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * storage_log_encode() - Build a record that turns one configuration into
+ * another.  Runs of changed bytes closer together than a segment header are
+ * merged into one segment.
+ *
+ * INPUT
+ *     - record: word-aligned destination
+ *     - record_size: size of destination in bytes
+ *     - from: configuration as flash holds it
+ *     - to: configuration to commit
+ *     - len: size of configuration
+ *     - record_len: bytes of record to append, 0 if nothing changed
+ * OUTPUT
+ *     true/false whether the changes fit in one record
+ */
+bool storage_log_encode(uint32_t *record, size_t record_size, const uint8_t *from,
+                        const uint8_t *to, size_t len, size_t *record_len)
+{
+    StorageLogRecord *header = (StorageLogRecord *)record;
+    uint8_t *out = (uint8_t *)record;
+    size_t pos = sizeof(*header);
+    size_t i = 0;
+
+    while(i < len)
+    {
+        if(from[i] == to[i])
+        {
+            i++;
+            continue;
+        }
+
+        size_t end = i + 1;
+
+        for(size_t j = end; j < len && j - end <= sizeof(StorageLogSegment); j++)
+        {
+            if(from[j] != to[j])
+            {
+                end = j + 1;
+            }
+        }
+
+        StorageLogSegment seg = { (uint16_t)i, (uint16_t)(end - i) };
+
+        if(record_size < pos + sizeof(seg) + seg.len)
+        {
+            return(false);
+        }
+
+        memcpy(out + pos, &seg, sizeof(seg));
+        memcpy(out + pos + sizeof(seg), to + i, seg.len);
+        pos += sizeof(seg) + seg.len;
+        i = end;
+    }
+
+    if(pos == sizeof(*header))
+    {
+        *record_len = 0;
+        return(true);
+    }
+
+    header->len = pos - sizeof(*header);
+    header->tag = STORAGE_LOG_TAG;
+    *record_len = storage_log_padded(header->len);
+
+    if(*record_len > record_size)
+    {
+        return(false);
+    }
+
+    /* Padding is left erased */
+    memset(out + pos, 0xFF, *record_len - pos);
+    header->crc = storage_log_crc(header);
+    return(true);
+}
+
+/*
+ * storage_log_replay() - Apply every intact record to a configuration
+ *
+ * INPUT
+ *     - log: word-aligned start of the log
+ *     - log_size: bytes from the start of the log to the end of the sector
+ *     - config: snapshot to bring up to date
+ *     - config_len: size of configuration
+ *     - log_len: bytes of intact records
+ * OUTPUT
+ *     true if more records can be appended after log_len; false if the log
+ *     ends in a damaged record or unerased flash
+ */
+bool storage_log_replay(const uint8_t *log, size_t log_size, uint8_t *config,
+                        size_t config_len, size_t *log_len)
+{
+    size_t pos = 0;
+
+    while(log_size - pos >= sizeof(StorageLogRecord))
+    {
+        const StorageLogRecord *record = (const StorageLogRecord *)(log + pos);
+        const uint8_t *segments = (const uint8_t *)(record + 1);
+
+        if(record->crc == 0xFFFFFFFF && record->len == 0xFFFF &&
+                record->tag == 0xFFFF)
+        {
+            break;
+        }
+
+        if(record->tag != STORAGE_LOG_TAG ||
+                storage_log_padded(record->len) > log_size - pos ||
+                storage_log_crc(record) != record->crc ||
+                !storage_log_apply(segments, record->len, NULL, config_len))
+        {
+            *log_len = pos;
+            return(false);
+        }
+
+        storage_log_apply(segments, record->len, config, config_len);
+        pos += storage_log_padded(record->len);
+    }
+
+    *log_len = pos;
+
+    for(size_t i = pos; i < log_size; i++)
+    {
+        if(log[i] != 0xFF)
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
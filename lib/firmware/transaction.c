@@ -224,12 +224,12 @@ uint32_t compile_script_multisig(const MultisigRedeemScriptType *multisig, uint8
 	if (n < 1 || n > 15) return 0;
 	uint32_t i, r = 0;
 	if (out) {
+		uint8_t pubkeys[15][33];
+		if (!cryptoMultisigPubkeys(multisig, pubkeys)) return 0;
 		out[r] = 0x50 + m; r++;
 		for (i = 0; i < n; i++) {
 			out[r] = 33; r++; // OP_PUSH 33
-			const uint8_t *pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
-			if (!pubkey) return 0;
-			memcpy(out + r, pubkey, 33); r += 33;
+			memcpy(out + r, pubkeys[i], 33); r += 33;
 		}
 		out[r] = 0x50 + n; r++;
 		out[r] = 0xAE; r++; // OP_CHECKMULTISIG
@@ -247,6 +247,9 @@ uint32_t compile_script_multisig_hash(const MultisigRedeemScriptType *multisig,
 	if (m < 1 || m > 15) return 0;
 	if (n < 1 || n > 15) return 0;
 
+	uint8_t pubkeys[15][33];
+	if (!cryptoMultisigPubkeys(multisig, pubkeys)) return 0;
+
 	SHA256_CTX ctx;
 	sha256_Init(&ctx);
 
@@ -255,9 +258,7 @@ uint32_t compile_script_multisig_hash(const MultisigRedeemScriptType *multisig,
 	uint32_t i;
 	for (i = 0; i < n; i++) {
 		d[0] = 33; sha256_Update(&ctx, d, 1); // OP_PUSH 33
-		const uint8_t *pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
-		if (!pubkey) return 0;
-		sha256_Update(&ctx, pubkey, 33);
+		sha256_Update(&ctx, pubkeys[i], 33);
 	}
 	d[0] = 0x50 + n;
 	d[1] = 0xAE;
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+"""Merge protocol additions into a copy of a device-protocol .proto file.
+
+Usage: extend-protocol.py <messages.proto> <additions>
+
+The additions file holds top level `enum` and `message` blocks in .proto
+syntax.  A block whose name the .proto file already defines has its lines
+added to the end of that definition; any other block is appended as a new
+definition.  Names and numbers that the .proto file already uses are an
+error, so an addition that has since landed upstream fails the build
+instead of being defined twice.
+
+The .proto file is rewritten in place.
+"""
+
+import re
+import sys
+
+BLOCK = re.compile(r'^\s*(enum|message)\s+(\w+)\s*\{')
+MEMBER = re.compile(r'(\w+)\s*=\s*(\d+)')
+
+
+def blocks(lines):
+    """Yield (kind, name, first line, closing line) of each top level block."""
+    i = 0
+    while i < len(lines):
+        match = BLOCK.match(lines[i])
+        if not match:
+            i += 1
+            continue
+
+        depth, j = 0, i
+        while True:
+            depth += lines[j].count('{') - lines[j].count('}')
+            if depth == 0:
+                break
+            j += 1
+            if j == len(lines):
+                sys.exit('unterminated %s %s' % match.groups())
+
+        yield match.group(1), match.group(2), i, j
+        i = j + 1
+
+
+def members(lines):
+    """Names and numbers of the fields or values in a block body."""
+    names, numbers = set(), set()
+    for line in lines:
+        match = MEMBER.search(line.split('//')[0])
+        if match:
+            names.add(match.group(1))
+            numbers.add(int(match.group(2)))
+    return names, numbers
+
+
+def extend(proto, additions):
+    for kind, name, start, end in list(blocks(additions)):
+        body = additions[start + 1:end]
+        found = [b for b in blocks(proto) if b[:2] == (kind, name)]
+
+        if not found:
+            proto += [''] + additions[start:end + 1]
+            continue
+
+        _, _, first, last = found[0]
+        names, numbers = members(proto[first + 1:last])
+        new_names, new_numbers = members(body)
+        clash = (names & new_names) or (numbers & new_numbers)
+        if clash:
+            sys.exit('%s %s already defines %s' % (kind, name, sorted(clash)))
+
+        proto[last:last] = body
+
+    return proto
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().splitlines()[2])
+
+    with open(sys.argv[1]) as f:
+        proto = f.read().splitlines()
+    with open(sys.argv[2]) as f:
+        additions = f.read().splitlines()
+
+    with open(sys.argv[1], 'w') as f:
+        f.write('\n'.join(extend(proto, additions)) + '\n')
+
+
+if __name__ == '__main__':
+    main()
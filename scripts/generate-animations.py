@@ -0,0 +1,148 @@
+#!/usr/bin/env python
+"""Encode the frames in lib/board/animations.txt as deltas between frames.
+
+Usage: generate-animations.py <animations.txt> <output.inc>
+
+The first frame is encoded against a blank rectangle and every later frame
+against the one before it, so a decoder only writes the pixels that change.
+Each frame is a series of runs, in raster order within the animation:
+
+    <skip> <count> <ceil(count / 2) bytes>
+
+skip is the number of unchanged pixels before the run and count the number
+of pixels it writes, each at most 255.  A run may rewrite up to MAX_GAP
+unchanged pixels between changed ones.  The new intensities follow, two
+to a byte, first pixel in the high nibble.  Each frame also carries the
+bounding box of its changed pixels, for the dirty region.
+"""
+
+import sys
+
+# Unchanged pixels folded into a run rather than starting a new one
+MAX_GAP = 3
+
+
+def parse(path):
+    animations, animation = [], None
+    with open(path) as f:
+        lines = [l.rstrip('\n') for l in f]
+
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        i += 1
+        if not words or words[0].startswith('#'):
+            continue
+
+        if words[0] == 'animation':
+            x, y, width, height, duration = [int(w) for w in words[2:7]]
+            animation = {'name': words[1], 'x': x, 'y': y, 'width': width,
+                         'height': height, 'duration': duration, 'frames': []}
+            animations.append(animation)
+            continue
+
+        if words[0] != 'frame':
+            sys.exit('%s:%d: unknown directive %r' % (path, i, words[0]))
+        if animation is None:
+            sys.exit('%s:%d: frame outside an animation' % (path, i))
+
+        rows = lines[i:i + animation['height']]
+        i += animation['height']
+        for row in rows:
+            if len(row) != animation['width'] or set(row) - set('0123456789abcdef'):
+                sys.exit('%s: bad row %r in %s' % (path, row, animation['name']))
+
+        animation['frames'].append([int(p, 16) for p in ''.join(rows)])
+
+    return animations
+
+
+def encode(previous, frame, width):
+    changed = [i for i in range(len(frame)) if frame[i] != previous[i]]
+    data, pos, k = [], 0, 0
+
+    while k < len(changed):
+        skip = changed[k] - pos
+        while skip > 255:
+            data += [255, 0]
+            skip -= 255
+            pos += 255
+
+        # A new run costs two bytes, so short gaps are rewritten instead
+        end = changed[k] + 1
+        k += 1
+        while (k < len(changed) and changed[k] - end <= MAX_GAP and
+               changed[k] + 1 - (pos + skip) <= 255):
+            end = changed[k] + 1
+            k += 1
+        count = end - (pos + skip)
+
+        run = frame[end - count:end] + [0]
+        data += [skip, count]
+        data += [(run[j] << 4) | run[j + 1] for j in range(0, count, 2)]
+        pos = end
+
+    if not changed:
+        return data, (0, 0, 0, 0)
+
+    xs = [i % width for i in changed]
+    ys = [i // width for i in changed]
+    left, top = min(xs), min(ys)
+    return data, (left, top, max(xs) - left + 1, max(ys) - top + 1)
+
+
+def hex_bytes(data, indent='    '):
+    lines = []
+    for start in range(0, len(data), 12):
+        lines.append(indent + ', '.join('0x%02x' % b for b in data[start:start + 12]))
+    return ',\n'.join(lines)
+
+
+def generate(animations):
+    out = ['/* Generated by scripts/generate-animations.py from lib/board/animations.txt */', '']
+
+    for animation in animations:
+        name, width = animation['name'], animation['width']
+        previous = [0] * (width * animation['height'])
+        data, frames = [], []
+
+        if width > 255 or animation['height'] > 255:
+            sys.exit('%s: too large for a byte bounding box' % name)
+
+        for frame in animation['frames']:
+            delta, box = encode(previous, frame, width)
+            frames.append((len(data), len(delta)) + box)
+            data += delta
+            previous = frame
+
+        if len(data) > 0xffff:
+            sys.exit('%s: deltas too long for 16 bit offsets' % name)
+
+        out.append('static const uint8_t %s_data[%d] =' % (name, len(data)))
+        out.append('{')
+        out.append(hex_bytes(data))
+        out.append('};')
+        out.append('')
+        out.append('static const DeltaFrame %s_frames[%d] =' % (name, len(frames)))
+        out.append('{')
+        out.append(',\n'.join('    { %d, %d, %d, %d, %d, %d }' % f for f in frames))
+        out.append('};')
+        out.append('')
+        out.append('static const DeltaAnimation %s = { %d, %d, %d, %d, %d, %d, %s_frames, %s_data };'
+                   % (name, animation['x'], animation['y'], width, animation['height'],
+                      animation['duration'], len(frames), name, name))
+        out.append('')
+
+    return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().splitlines()[2])
+
+    with open(sys.argv[2], 'w') as f:
+        f.write(generate(parse(sys.argv[1])))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+"""Pack the glyphs in lib/board/fonts.txt into 1 bit per pixel C tables.
+
+Usage: generate-fonts.py <fonts.txt> <output.inc>
+
+Each glyph row is packed most significant bit first and padded to a whole
+byte; a set bit is drawn in the text color.  Every font gets one table of
+CharacterImage entries indexed by character code, so looking a character up
+is a subtraction.  Codes missing from the middle of a font fall back to the
+sadface image.
+"""
+
+import sys
+
+
+def parse(path):
+    images, fonts, font = [], [], None
+    with open(path) as f:
+        lines = [l.rstrip('\n') for l in f]
+
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        i += 1
+        if not words or words[0].startswith('#'):
+            continue
+
+        if words[0] == 'font':
+            font = {'name': words[1], 'size': int(words[2]), 'chars': {}}
+            fonts.append(font)
+            continue
+
+        if words[0] not in ('image', 'char'):
+            sys.exit('%s:%d: unknown directive %r' % (path, i, words[0]))
+
+        width, height = int(words[2]), int(words[3])
+        rows = lines[i:i + height]
+        i += height
+        for row in rows:
+            if len(row) != width or set(row) - set('#.'):
+                sys.exit('%s: bad row %r in %s' % (path, row, words[1]))
+
+        glyph = (width, height, pack(rows, width))
+        if words[0] == 'image':
+            images.append((words[1], glyph))
+        elif font is None:
+            sys.exit('%s:%d: char outside a font' % (path, i))
+        else:
+            font['chars'][int(words[1], 0)] = glyph
+
+    return images, fonts
+
+
+def pack(rows, width):
+    data = []
+    for row in rows:
+        for start in range(0, width, 8):
+            byte = 0
+            for bit, pixel in enumerate(row[start:start + 8]):
+                if pixel == '#':
+                    byte |= 0x80 >> bit
+            data.append(byte)
+    return data
+
+
+def hex_bytes(data, indent='    '):
+    lines = []
+    for start in range(0, len(data), 12):
+        lines.append(indent + ', '.join('0x%02x' % b for b in data[start:start + 12]))
+    return ',\n'.join(lines)
+
+
+def label(code):
+    c = chr(code)
+    return "'%s'" % c if 0x20 <= code < 0x7f and c not in "'\\*/" else '0x%02x' % code
+
+
+def generate(images, fonts):
+    out = ['/* Generated by scripts/generate-fonts.py from lib/board/fonts.txt */', '']
+    fallback = dict(images).get('sadface')
+    if fallback is None:
+        sys.exit('fonts need the sadface image for missing characters')
+
+    for name, (width, height, data) in images:
+        out.append('static const uint8_t image_data_%s[%d] =' % (name, len(data)))
+        out.append('{')
+        out.append(hex_bytes(data))
+        out.append('};')
+        out.append('static const CharacterImage %s = { image_data_%s, %d, %d };'
+                   % (name, name, width, height))
+        out.append('')
+
+    for font in fonts:
+        name, chars = font['name'], font['chars']
+        first, last = min(chars), max(chars)
+        offsets, data = {}, []
+        for code in sorted(chars):
+            offsets[code] = len(data)
+            data.extend(chars[code][2])
+
+        out.append('static const uint8_t %s_data[%d] =' % (name, len(data)))
+        out.append('{')
+        out.append(hex_bytes(data))
+        out.append('};')
+        out.append('')
+        out.append('static const CharacterImage %s_images[%d] =' % (name, last - first + 1))
+        out.append('{')
+        entries = []
+        for code in range(first, last + 1):
+            if code in chars:
+                width, height, _ = chars[code]
+                entries.append('    { &%s_data[%d], %d, %d }'
+                               % (name, offsets[code], width, height))
+            else:
+                entries.append('    { image_data_sadface, %d, %d }' % fallback[:2])
+            entries[-1] += ',' if code != last else ' '
+            entries[-1] += '  /* %s */' % label(code)
+        out.extend(entries)
+        out.append('};')
+        out.append('')
+        out.append('static const Font %s = { 0x%02x, %d, %d, %s_images };'
+                   % (name, first, last - first + 1, font['size'], name))
+        out.append('')
+
+    return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().splitlines()[2])
+
+    images, fonts = parse(sys.argv[1])
+    with open(sys.argv[2], 'w') as f:
+        f.write(generate(images, fonts))
+
+
+if __name__ == '__main__':
+    main()
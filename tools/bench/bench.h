@@ -0,0 +1,41 @@
+#ifndef KEEPKEY_BENCH_H
+#define KEEPKEY_BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/// Wall clock stopwatch for host benchmarks.
+class Stopwatch {
+public:
+    Stopwatch() : start(std::chrono::steady_clock::now()) {}
+
+    double seconds() const {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+/// Print one result line: name, iterations, time per iteration and, when
+/// bytes is non-zero, throughput.
+inline void bench_report(const char *name, uint64_t iterations,
+                         double seconds, uint64_t bytes = 0) {
+    printf("%-40s %10llu iters %12.3f us/iter", name,
+           (unsigned long long)iterations, seconds * 1e6 / iterations);
+    if (bytes)
+        printf(" %10.2f MB/s", bytes / seconds / 1e6);
+    printf("\n");
+}
+
+void bench_display(void);
+void bench_ecdsa(void);
+void bench_field(void);
+void bench_flash(void);
+void bench_pbkdf2(void);
+void bench_rawtx(void);
+void bench_sha2(void);
+
+#endif
@@ -0,0 +1,110 @@
+extern "C" {
+#include "keepkey/board/draw.h"
+#include "keepkey/board/font.h"
+#include "keepkey/board/keepkey_display.h"
+#include "keepkey/board/resources.h"
+}
+
+#include "bench.h"
+
+#include <cstring>
+
+/// Modelled cycles per byte of the handshake the burst writer replaced:
+/// nine GPIO stores at two cycles each and 17 nops.
+static const uint64_t legacy_byte_cycles = 9 * 2 + 17;
+
+static const double cpu_hz = 120e6;
+
+/// Report modelled bus time at 120 MHz, next to the host time of the same
+/// refreshes, and the bytes each frame pushed to the display.
+static void display_report(const char *name, uint64_t frames, double seconds,
+                           uint64_t cycles, uint64_t bytes) {
+    char device[64];
+
+    bench_report(name, frames, seconds, bytes);
+    snprintf(device, sizeof(device), "%s (device)", name);
+    bench_report(device, frames, cycles / cpu_hz, bytes);
+    printf("%-40s %10llu bytes/frame\n", name,
+           (unsigned long long)(bytes / frames));
+}
+
+/// The byte-per-pixel canvas and whole-screen, byte-at-a-time refresh the
+/// packed canvas and burst writer replaced, kept as the baseline.
+class LegacyDisplay {
+public:
+    uint32_t bytes = 0;
+
+    void refresh() {
+        for (int i = 0; i < KEEPKEY_DISPLAY_WIDTH * KEEPKEY_DISPLAY_HEIGHT; i += 2)
+            write_ram((0xF0 & pixels[i]) | (pixels[i + 1] >> 4));
+    }
+
+private:
+    uint8_t pixels[KEEPKEY_DISPLAY_WIDTH * KEEPKEY_DISPLAY_HEIGHT] = {};
+    volatile uint8_t bus = 0;
+
+    void write_ram(uint8_t val) {
+        bus = val;
+        bytes++;
+    }
+};
+
+/// Time `frames` refreshes after `draw` against the legacy full-screen
+/// refresh.
+template <typename Draw>
+static void bench_refresh(const char *name, int frames, Draw draw) {
+    Canvas *canvas = display_canvas();
+    LegacyDisplay legacy;
+    char label[64];
+    double seconds = 0;
+    uint64_t cycles = 0;
+    uint32_t bytes = 0;
+
+    Stopwatch legacy_time;
+    for (int it = 0; it < frames; it++)
+        legacy.refresh();
+    snprintf(label, sizeof(label), "legacy refresh, %s", name);
+    display_report(label, frames, legacy_time.seconds(),
+                   legacy.bytes * legacy_byte_cycles, legacy.bytes);
+
+    for (int it = 0; it < frames; it++) {
+        draw(canvas, it);
+
+        uint32_t before = display_bytes_written();
+        uint64_t cycles_before = display_bus_cycles();
+        Stopwatch time;
+        display_refresh();
+        seconds += time.seconds();
+        cycles += display_bus_cycles() - cycles_before;
+        bytes += display_bytes_written() - before;
+    }
+    snprintf(label, sizeof(label), "display_refresh, %s", name);
+    display_report(label, frames, seconds, cycles, bytes);
+}
+
+void bench_display(void) {
+    display_canvas_init();
+    const int frames = 200;
+
+    bench_refresh("full screen", frames, [](Canvas *canvas, int it) {
+        DrawableParams sp = { 0xFF, 4, 4 };
+        draw_box_simple(canvas, 0x00, 0, 0, KEEPKEY_DISPLAY_WIDTH,
+                        KEEPKEY_DISPLAY_HEIGHT);
+        draw_string(canvas, get_body_font(),
+                    it % 2 ? "Send 0.1 BTC to 1BoatSLRHtKNngkdXEeobR76b53LETtpyT"
+                           : "Confirm the address on your computer",
+                    &sp, KEEPKEY_DISPLAY_WIDTH - 8, font_height(get_body_font()));
+    });
+
+    bench_refresh("progress bar step", frames, [](Canvas *canvas, int it) {
+        draw_box_simple(canvas, 0xFF, 20 + it % 200, 50, 1, 6);
+    });
+
+    const DeltaAnimation *loading = get_loading_animation();
+    bench_refresh("loading frame", frames, [loading](Canvas *canvas, int it) {
+        int frame = it % loading->count;
+        if (frame == 0)
+            canvas_fill(canvas, loading->x, loading->y, loading->w, loading->h, 0x00);
+        draw_delta_frame(canvas, loading, frame);
+    });
+}
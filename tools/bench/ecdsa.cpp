@@ -0,0 +1,62 @@
+extern "C" {
+#include "keepkey/crypto/ecdsa.h"
+#include "keepkey/crypto/nist256p1.h"
+#include "keepkey/crypto/secp256k1.h"
+}
+
+#include "bench.h"
+
+#include <cstring>
+
+static void bench_curve(const char *curve_name, const ecdsa_curve *curve) {
+    const int iters = 100;
+    char name[64];
+    uint8_t priv_key[32], pub_key[33], pub_key65[65], digest[32], sig[64];
+    uint8_t pby;
+
+    memset(priv_key, 0x37, sizeof(priv_key));
+    memset(digest, 0x55, sizeof(digest));
+    ecdsa_get_public_key33(curve, priv_key, pub_key);
+    ecdsa_sign_digest(curve, priv_key, digest, sig, &pby);
+
+    bignum256 k;
+    curve_point p, res;
+    bn_read_be(digest, &k);
+    scalar_multiply(curve, &k, &p);
+
+    Stopwatch point_time;
+    for (int i = 0; i < iters; i++)
+        point_multiply(curve, &k, &p, &res);
+    snprintf(name, sizeof(name), "%s point_multiply", curve_name);
+    bench_report(name, iters, point_time.seconds());
+
+    Stopwatch scalar_time;
+    for (int i = 0; i < iters; i++)
+        scalar_multiply(curve, &k, &res);
+    snprintf(name, sizeof(name), "%s scalar_multiply", curve_name);
+    bench_report(name, iters, scalar_time.seconds());
+
+    Stopwatch sign_time;
+    for (int i = 0; i < iters; i++)
+        ecdsa_sign_digest(curve, priv_key, digest, sig, &pby);
+    snprintf(name, sizeof(name), "%s ecdsa_sign_digest", curve_name);
+    bench_report(name, iters, sign_time.seconds());
+
+    Stopwatch verify_time;
+    for (int i = 0; i < iters; i++)
+        if (ecdsa_verify_digest(curve, pub_key, sig, digest) != 0)
+            printf("%s: verification failed\n", curve_name);
+    snprintf(name, sizeof(name), "%s ecdsa_verify_digest", curve_name);
+    bench_report(name, iters, verify_time.seconds());
+
+    Stopwatch recover_time;
+    for (int i = 0; i < iters; i++)
+        ecdsa_verify_digest_recover(curve, pub_key65, sig, digest, pby);
+    snprintf(name, sizeof(name), "%s ecdsa_verify_digest_recover", curve_name);
+    bench_report(name, iters, recover_time.seconds());
+}
+
+void bench_ecdsa(void) {
+    bench_curve("secp256k1", &secp256k1);
+    bench_curve("nist256p1", &nist256p1);
+}
@@ -0,0 +1,102 @@
+extern "C" {
+#include "keepkey/crypto/bip32.h"
+#include "keepkey/crypto/curves.h"
+#include "keepkey/crypto/ecdsa.h"
+#include "keepkey/crypto/nist256p1.h"
+#include "keepkey/crypto/secp256k1.h"
+}
+
+#include "bench.h"
+
+#include <cstring>
+
+static void bench_field(const char *curve_name, const ecdsa_curve *curve) {
+    const int iters = 200000;
+    char name[64];
+    bignum256 k = curve->G.x, x = curve->G.y;
+
+    Stopwatch generic_time;
+    for (int i = 0; i < iters; i++)
+        bn_multiply(&k, &x, &curve->prime);
+    snprintf(name, sizeof(name), "%s bn_multiply generic", curve_name);
+    bench_report(name, iters, generic_time.seconds());
+
+    Stopwatch kernel_time;
+    for (int i = 0; i < iters; i++)
+        bn_multiply_with(&k, &x, &curve->prime, curve->multiply_reduce);
+    snprintf(name, sizeof(name), "%s bn_multiply curve kernel", curve_name);
+    bench_report(name, iters, kernel_time.seconds());
+
+    const int inverse_iters = iters / 100;
+    Stopwatch inverse_time;
+    for (int i = 0; i < inverse_iters; i++)
+        bn_inverse(&x, &curve->prime);
+    snprintf(name, sizeof(name), "%s bn_inverse", curve_name);
+    bench_report(name, inverse_iters, inverse_time.seconds());
+}
+
+static void bench_derive(const char *curve_name) {
+    const int iters = 100;
+    char name[64];
+    uint8_t seed[32];
+    HDNode root, node;
+
+    memset(seed, 0x42, sizeof(seed));
+    hdnode_from_seed(seed, sizeof(seed), curve_name, &root);
+
+    // m/i/0: two non-hardened private steps and the public key an address
+    // is made from.
+    Stopwatch derive_time;
+    for (int i = 0; i < iters; i++) {
+        node = root;
+        hdnode_private_ckd(&node, i);
+        hdnode_private_ckd(&node, 0);
+        hdnode_fill_public_key(&node);
+    }
+    snprintf(name, sizeof(name), "%s address derivation", curve_name);
+    bench_report(name, iters, derive_time.seconds());
+}
+
+static void bench_public_ckd(void) {
+    const uint32_t count = 64;
+    const int iters = 5;
+    char name[64];
+    uint8_t seed[32];
+    uint32_t index[count];
+    HDNode account, nodes[count];
+
+    memset(seed, 0x42, sizeof(seed));
+    hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &account);
+    hdnode_private_ckd_prime(&account, 0);
+    hdnode_fill_public_key(&account);
+    memset(account.private_key, 0, sizeof(account.private_key));
+    for (uint32_t i = 0; i < count; i++)
+        index[i] = i;
+
+    Stopwatch single_time;
+    for (int it = 0; it < iters; it++) {
+        for (uint32_t i = 0; i < count; i++) {
+            nodes[i] = account;
+            hdnode_public_ckd(&nodes[i], i);
+        }
+    }
+    snprintf(name, sizeof(name), "hdnode_public_ckd x%u", count);
+    bench_report(name, iters * count, single_time.seconds());
+
+    Stopwatch batch_time;
+    for (int it = 0; it < iters; it++) {
+        for (uint32_t i = 0; i < count; i++)
+            nodes[i] = account;
+        hdnode_public_ckd_batch(nodes, index, count);
+    }
+    snprintf(name, sizeof(name), "hdnode_public_ckd_batch x%u", count);
+    bench_report(name, iters * count, batch_time.seconds());
+}
+
+void bench_field(void) {
+    bench_field("secp256k1", &secp256k1);
+    bench_field("nist256p1", &nist256p1);
+    bench_derive(SECP256K1_NAME);
+    bench_derive(NIST256P1_NAME);
+    bench_public_ckd();
+}
@@ -0,0 +1,190 @@
+extern "C" {
+#include "keepkey/board/flash_sim.h"
+#include "keepkey/board/keepkey_board.h"
+#include "keepkey/board/keepkey_flash.h"
+#include "keepkey/board/memory.h"
+#include "keepkey/board/upload_session.h"
+#include "keepkey/bootloader/usb_flash.h"
+#include "keepkey/firmware/storage.h"
+}
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/// Report the flash controller time the simulator charged, next to the host
+/// time of the same run.
+static void flash_report(const char *name, uint64_t iterations,
+                         double seconds, uint64_t busy_us, uint64_t bytes) {
+    char device[64];
+
+    bench_report(name, iterations, seconds, bytes);
+    snprintf(device, sizeof(device), "%s (device)", name);
+    bench_report(device, iterations, busy_us / 1e6, bytes);
+}
+
+static uint64_t busy_since(const FlashSimStats &before) {
+    FlashSimStats after;
+    flash_sim_stats(&after);
+    return after.busy_us - before.busy_us;
+}
+
+/// The programming paths flash_write_word() replaced, kept as the baseline:
+/// word writes verified by a CRC pass over flash, and byte writes verified by
+/// comparing flash afterwards.
+static bool legacy_write_word(Allocation group, uint32_t offset, uint32_t len,
+                              const uint8_t *data) {
+    uint32_t start = flash_write_helper(group) + offset;
+    for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));
+        flash_program_word(start, word);
+        if (!flash_chk_status())
+            return false;
+        start += sizeof(uint32_t);
+        data += sizeof(uint32_t);
+    }
+    flash_program(start, data, len);
+    return flash_chk_status();
+}
+
+static bool legacy_commit(Allocation group, std::vector<uint8_t> &config) {
+    uint32_t ram_crc = calc_crc32((uint32_t *)config.data(), config.size() / 4);
+    if (!legacy_write_word(group, 0, config.size(), config.data()))
+        return false;
+    uintptr_t flash = flash_write_helper(group);
+    return calc_crc32((uint32_t *)flash, config.size() / 4) == ram_crc;
+}
+
+static bool legacy_image(Allocation group, std::vector<uint8_t> &image) {
+    uint32_t start = flash_write_helper(group);
+    flash_program(start, image.data(), image.size());
+    return flash_chk_status() &&
+           memcmp((const void *)(uintptr_t)start, image.data(), image.size()) == 0;
+}
+
+/// Time `write` into freshly erased flash, leaving the erases out.
+template <typename Write>
+static void bench_write(const char *name, Allocation group,
+                        std::vector<uint8_t> &data, int iters, Write write) {
+    double seconds = 0;
+    uint64_t busy_us = 0;
+
+    for (int it = 0; it < iters; it++) {
+        flash_unlock();
+        flash_erase_word(group);
+
+        FlashSimStats before;
+        flash_sim_stats(&before);
+        Stopwatch time;
+        bool ok = write(group, data);
+        seconds += time.seconds();
+        busy_us += busy_since(before);
+        flash_lock();
+
+        if (!ok) {
+            printf("%s failed\n", name);
+            return;
+        }
+    }
+
+    flash_report(name, iters, seconds, busy_us, (uint64_t)data.size() * iters);
+}
+
+/// Upload an image through the bootloader's chunked upload handlers, into
+/// application sectors erased as FirmwareErase leaves them.
+static bool upload(const std::vector<uint8_t> &image, const uint8_t *hash) {
+    flash_unlock();
+    flash_erase_word(FLASH_APP);
+    flash_lock();
+
+    FirmwareUploadStart start;
+    memset(&start, 0, sizeof(start));
+    memcpy(start.hash.bytes, hash, SHA256_DIGEST_LENGTH);
+    start.hash.size = SHA256_DIGEST_LENGTH;
+    start.length = image.size();
+    handler_upload_start(&start);
+
+    FirmwareUploadChunk chunk;
+    for (uint32_t offset = 0; offset < image.size(); offset += UPLOAD_CHUNK_SIZE) {
+        uint32_t len = std::min<uint32_t>(UPLOAD_CHUNK_SIZE, image.size() - offset);
+        memset(&chunk, 0, sizeof(chunk));
+        chunk.offset = offset;
+        chunk.payload.size = len;
+        memcpy(chunk.payload.bytes, image.data() + offset, len);
+        handler_upload_chunk(&chunk);
+    }
+
+    return usb_flash_reset_upload();
+}
+
+static std::vector<uint8_t> test_image(uint32_t code_len) {
+    std::vector<uint8_t> image(FLASH_META_DESC_LEN + code_len);
+    for (size_t i = 0; i < image.size(); i++)
+        image[i] = i * 13;
+    memcpy(image.data(), META_MAGIC_STR, META_MAGIC_SIZE);
+    memcpy(image.data() + META_MAGIC_SIZE, &code_len, sizeof(code_len));
+    return image;
+}
+
+void bench_flash(void) {
+    if (!flash_sim_init(NULL)) {
+        printf("cannot map flash at 0x%08x\n", FLASH_ORIGIN);
+        return;
+    }
+
+    storage_init();
+
+    FlashSimStats before;
+    const int commits = 30;
+    flash_sim_stats(&before);
+    Stopwatch commit_time;
+    for (int it = 0; it < commits; it++) {
+        storage_set_label(it % 2 ? "odd" : "even");
+        storage_commit();
+    }
+    flash_report("storage_commit", commits, commit_time.seconds(),
+                 busy_since(before), sizeof(ConfigFlash) * commits);
+
+    // A whole config snapshot, as storage_compact() writes it.
+    std::vector<uint8_t> config(sizeof(ConfigFlash) & ~3u);
+    for (size_t i = 0; i < config.size(); i++)
+        config[i] = i * 7;
+    bench_write("legacy snapshot + crc", FLASH_STORAGE1, config, 30, legacy_commit);
+    bench_write("flash_write_word snapshot", FLASH_STORAGE1, config, 30,
+                [](Allocation group, std::vector<uint8_t> &data) {
+                    return flash_write_word(group, 0, data.size(), data.data());
+                });
+
+    // The biggest image the application sectors hold.
+    std::vector<uint8_t> image = test_image(FLASH_APP_LEN);
+    bench_write("legacy image bytes + memcmp", FLASH_APP, image, 3, legacy_image);
+    bench_write("flash_write image", FLASH_APP, image, 3,
+                [](Allocation group, std::vector<uint8_t> &data) {
+                    return flash_write(group, 0, data.size(), data.data());
+                });
+
+    for (uint32_t code_len : { 128 * 1024, 512 * 1024 }) {
+        image = test_image(code_len);
+        uint8_t hash[SHA256_DIGEST_LENGTH];
+        sha256_Raw(image.data(), image.size(), hash);
+
+        const int iters = 3;
+        char name[64];
+        flash_sim_stats(&before);
+        Stopwatch upload_time;
+        for (int it = 0; it < iters; it++) {
+            if (!upload(image, hash)) {
+                printf("upload of %zu bytes failed\n", image.size());
+                return;
+            }
+        }
+        snprintf(name, sizeof(name), "chunked upload %zu bytes", image.size());
+        flash_report(name, iters, upload_time.seconds(), busy_since(before),
+                     (uint64_t)image.size() * iters);
+    }
+
+    flash_sim_close();
+}
@@ -0,0 +1,40 @@
+#include "bench.h"
+
+#include <cstring>
+
+struct Benchmark {
+    const char *name;
+    void (*run)(void);
+};
+
+static const Benchmark benchmarks[] = {
+    { "display", bench_display },
+    { "ecdsa", bench_ecdsa },
+    { "field", bench_field },
+    { "flash", bench_flash },
+    { "pbkdf2", bench_pbkdf2 },
+    { "rawtx", bench_rawtx },
+    { "sha2", bench_sha2 },
+};
+
+int main(int argc, char *argv[]) {
+    bool ran = false;
+
+    for (const Benchmark &b : benchmarks) {
+        if (argc > 1 && strcmp(argv[1], b.name) != 0)
+            continue;
+        printf("== %s\n", b.name);
+        b.run();
+        ran = true;
+    }
+
+    if (!ran) {
+        fprintf(stderr, "usage: %s [", argv[0]);
+        for (const Benchmark &b : benchmarks)
+            fprintf(stderr, " %s", b.name);
+        fprintf(stderr, " ]\n");
+        return 1;
+    }
+
+    return 0;
+}
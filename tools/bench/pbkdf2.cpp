@@ -0,0 +1,53 @@
+extern "C" {
+#include "keepkey/crypto/bip39.h"
+#include "keepkey/crypto/pbkdf2.h"
+#include "keepkey/crypto/sha2.h"
+}
+
+#include "bench.h"
+
+#include <cstring>
+
+/// The iteration loop pbkdf2_hmac_sha512_Update() used before the digest
+/// kernel, kept as the baseline: two generic block transforms per round.
+static void legacy_update(PBKDF2_HMAC_SHA512_CTX *pctx, uint32_t iterations) {
+    for (uint32_t i = pctx->first; i < iterations; i++) {
+        sha512_Transform(pctx->idig, pctx->g, pctx->g);
+        sha512_Transform(pctx->odig, pctx->g, pctx->g);
+        for (uint32_t j = 0; j < SHA512_DIGEST_LENGTH / sizeof(uint64_t); j++)
+            pctx->f[j] ^= pctx->g[j];
+    }
+    pctx->first = 0;
+}
+
+void bench_pbkdf2(void) {
+    static const char mnemonic[] =
+        "abandon abandon abandon abandon abandon abandon abandon abandon "
+        "abandon abandon abandon about";
+    static const char salt[] = "mnemonicTREZOR";
+    const int iters = 50;
+    uint8_t legacy_key[64], key[64];
+
+    Stopwatch legacy_time;
+    for (int it = 0; it < iters; it++) {
+        PBKDF2_HMAC_SHA512_CTX pctx;
+        pbkdf2_hmac_sha512_Init(&pctx, (const uint8_t *)mnemonic,
+                                strlen(mnemonic), (const uint8_t *)salt,
+                                strlen(salt));
+        legacy_update(&pctx, BIP39_PBKDF2_ROUNDS);
+        pbkdf2_hmac_sha512_Final(&pctx, legacy_key);
+    }
+    bench_report("legacy pbkdf2 rounds", (uint64_t)iters * BIP39_PBKDF2_ROUNDS,
+                 legacy_time.seconds());
+
+    Stopwatch kernel_time;
+    for (int it = 0; it < iters; it++)
+        pbkdf2_hmac_sha512((const uint8_t *)mnemonic, strlen(mnemonic),
+                           (const uint8_t *)salt, strlen(salt),
+                           BIP39_PBKDF2_ROUNDS, key, NULL);
+    bench_report("pbkdf2_hmac_sha512 rounds", (uint64_t)iters * BIP39_PBKDF2_ROUNDS,
+                 kernel_time.seconds());
+
+    if (memcmp(key, legacy_key, sizeof(key)) != 0)
+        printf("pbkdf2_hmac_sha512 MISMATCH\n");
+}
@@ -0,0 +1,226 @@
+extern "C" {
+#include "keepkey/crypto/bip32.h"
+#include "keepkey/crypto/curves.h"
+#include "keepkey/crypto/sha2.h"
+#include "keepkey/firmware/coins.h"
+#include "keepkey/firmware/crypto.h"
+#include "keepkey/firmware/signing.h"
+#include "types.pb.h"
+}
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/// Serialize a legacy transaction shaped like an exchange batch payout:
+/// one input, many P2PKH outputs.
+static std::vector<uint8_t> batch_payout(uint32_t outputs) {
+    std::vector<uint8_t> tx;
+    uint8_t buf[8];
+
+    auto put = [&](const void *data, size_t len) {
+        const uint8_t *p = (const uint8_t *)data;
+        tx.insert(tx.end(), p, p + len);
+    };
+
+    uint32_t version = 1;
+    put(&version, 4);
+    put(buf, ser_length(1, buf));
+    for (int i = 0; i < 36; i++)
+        tx.push_back(i * 7);
+    uint8_t script_sig[107];
+    memset(script_sig, 0x5a, sizeof(script_sig));
+    put(buf, ser_length(sizeof(script_sig), buf));
+    put(script_sig, sizeof(script_sig));
+    uint32_t sequence = 0xffffffff;
+    put(&sequence, 4);
+
+    put(buf, ser_length(outputs, buf));
+    for (uint32_t i = 0; i < outputs; i++) {
+        uint64_t amount = 10000 + i;
+        put(&amount, 8);
+        uint8_t script[25] = { 0x76, 0xa9, 0x14 };
+        memcpy(script + 3, &i, sizeof(i));
+        script[23] = 0x88;
+        script[24] = 0xac;
+        put(buf, ser_length(sizeof(script), buf));
+        put(script, sizeof(script));
+    }
+
+    uint32_t lock_time = 0;
+    put(&lock_time, 4);
+    return tx;
+}
+
+/// The byte-at-a-time parser that parse_raw_txack() replaced, kept as the
+/// baseline. It walks the same states and hashes one byte per update.
+class LegacyRawTxParser {
+public:
+    uint64_t amount = 0;
+    uint8_t hash[32];
+
+    void parse(const uint8_t *msg, uint32_t msg_size, uint32_t prev_index) {
+        for (uint32_t i = 0; i < msg_size; ++i) {
+            state_pos--;
+            switch (status) {
+            case NOT_PARSING:
+                sha256_Init(&ctx);
+                state_pos = 4;
+                status = VERSION;
+                // fall through
+            case VERSION:
+                if (state_pos == 1)
+                    next_var_int(INPUT_COUNT);
+                break;
+            case INPUT_COUNT:
+                var_int_buf[var_int_idx++] = msg[i];
+                if (var_int_idx >= deser_length(var_int_buf, &count)) {
+                    status = INPUTS;
+                    state_pos = 36;
+                    seen = 0;
+                    reset();
+                }
+                break;
+            case INPUTS:
+                if (state_pos < 0 && seen < count) {
+                    var_int_buf[var_int_idx++] = msg[i];
+                    if (var_int_idx >= deser_length(var_int_buf, &script_len)) {
+                        seen++;
+                        state_pos = seen < count ? script_len + 4 + 36 : script_len + 3;
+                        reset();
+                    }
+                } else if (state_pos < 0) {
+                    status = OUTPUT_COUNT;
+                }
+                break;
+            case OUTPUT_COUNT:
+                var_int_buf[var_int_idx++] = msg[i];
+                if (var_int_idx >= deser_length(var_int_buf, &count)) {
+                    status = OUTPUTS_VALUE;
+                    state_pos = 8;
+                    seen = 0;
+                    value = 0;
+                    ptr = (uint8_t *)&value;
+                    reset();
+                }
+                break;
+            case OUTPUTS_VALUE:
+                *ptr++ = msg[i];
+                if (state_pos < 1) {
+                    if (seen == prev_index)
+                        amount += value;
+                    status = OUTPUTS;
+                    reset();
+                }
+                break;
+            case OUTPUTS:
+                if (state_pos < 0 && seen < count) {
+                    var_int_buf[var_int_idx++] = msg[i];
+                    if (var_int_idx >= deser_length(var_int_buf, &script_len)) {
+                        seen++;
+                        if (seen < count) {
+                            value = 0;
+                            ptr = (uint8_t *)&value;
+                            status = OUTPUTS_VALUE;
+                            state_pos = script_len + 8;
+                        } else {
+                            state_pos = script_len - 1;
+                        }
+                    }
+                } else if (state_pos < 0) {
+                    status = LOCKTIME;
+                    state_pos = 4;
+                    reset();
+                }
+                break;
+            case LOCKTIME:
+                if (state_pos < 1) {
+                    status = NOT_PARSING;
+                    sha256_Update(&ctx, msg + i, 1);
+                    sha256_Final(&ctx, hash);
+                    sha256_Raw(hash, 32, hash);
+                    return;
+                }
+                break;
+            }
+            sha256_Update(&ctx, msg + i, 1);
+        }
+    }
+
+private:
+    enum {
+        NOT_PARSING, VERSION, INPUT_COUNT, INPUTS, OUTPUT_COUNT,
+        OUTPUTS_VALUE, OUTPUTS, LOCKTIME
+    } status = NOT_PARSING;
+    int32_t state_pos = 0;
+    uint8_t var_int_buf[VAR_INT_BUFFER];
+    uint8_t var_int_idx = 0;
+    uint32_t count = 0, seen = 0, script_len = 0;
+    uint64_t value = 0;
+    uint8_t *ptr = nullptr;
+    SHA256_CTX ctx;
+
+    void reset() {
+        memset(var_int_buf, 0, sizeof(var_int_buf));
+        var_int_idx = 0;
+    }
+
+    void next_var_int(decltype(status) s) {
+        status = s;
+        reset();
+    }
+};
+
+void bench_rawtx(void) {
+    static const uint32_t chunk = 64 - 1;
+    const CoinType *coin = coinByName("Bitcoin");
+    HDNode root;
+    uint8_t seed[32];
+    memset(seed, 0x42, sizeof(seed));
+    hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &root);
+
+    for (uint32_t outputs : { 1500, 3000 }) {
+        std::vector<uint8_t> tx = batch_payout(outputs);
+        const int iters = 20;
+        char name[64];
+
+        uint8_t txid[32];
+        sha256_Raw(tx.data(), tx.size(), txid);
+        sha256_Raw(txid, 32, txid);
+
+        Stopwatch legacy_time;
+        for (int it = 0; it < iters; it++) {
+            LegacyRawTxParser parser;
+            for (size_t off = 0; off < tx.size(); off += chunk)
+                parser.parse(tx.data() + off,
+                             std::min<size_t>(chunk, tx.size() - off), 0);
+        }
+        snprintf(name, sizeof(name), "legacy parser %zu bytes", tx.size());
+        bench_report(name, iters, legacy_time.seconds(), tx.size() * iters);
+
+        TransactionType txack;
+        memset(&txack, 0, sizeof(txack));
+        txack.inputs_count = 1;
+        txack.inputs[0].prev_hash.size = 32;
+        for (int i = 0; i < 32; i++)
+            txack.inputs[0].prev_hash.bytes[i] = txid[31 - i];
+        txack.inputs[0].prev_index = 0;
+        txack.inputs[0].has_script_type = true;
+        txack.inputs[0].script_type = InputScriptType_SPENDADDRESS;
+
+        Stopwatch span_time;
+        for (int it = 0; it < iters; it++) {
+            signing_init(1, 1, coin, &root, 1, 0);
+            TransactionType copy = txack;
+            signing_txack(&copy);
+            for (size_t off = 0; off < tx.size(); off += chunk)
+                parse_raw_txack(tx.data() + off,
+                                std::min<size_t>(chunk, tx.size() - off));
+        }
+        snprintf(name, sizeof(name), "parse_raw_txack %zu bytes", tx.size());
+        bench_report(name, iters, span_time.seconds(), tx.size() * iters);
+        signing_abort();
+    }
+}
@@ -0,0 +1,37 @@
+extern "C" {
+#include "keepkey/crypto/sha2.h"
+}
+
+#include "bench.h"
+
+#include <vector>
+
+void bench_sha2(void) {
+    for (size_t size : { 1024, 16 * 1024, 1024 * 1024 }) {
+        std::vector<uint8_t> data(size + 1);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = i * 31;
+        const int iters = (int)(8 * 1024 * 1024 / size);
+        uint8_t digest[SHA512_DIGEST_LENGTH];
+        char name[64];
+
+        Stopwatch sha256_time;
+        for (int it = 0; it < iters; it++)
+            sha256_Raw(data.data(), size, digest);
+        snprintf(name, sizeof(name), "sha256_Raw %zu bytes", size);
+        bench_report(name, iters, sha256_time.seconds(), (uint64_t)size * iters);
+
+        // misaligned input, as hashed from the middle of a message buffer
+        Stopwatch sha256_odd_time;
+        for (int it = 0; it < iters; it++)
+            sha256_Raw(data.data() + 1, size, digest);
+        snprintf(name, sizeof(name), "sha256_Raw %zu bytes misaligned", size);
+        bench_report(name, iters, sha256_odd_time.seconds(), (uint64_t)size * iters);
+
+        Stopwatch sha512_time;
+        for (int it = 0; it < iters; it++)
+            sha512_Raw(data.data(), size, digest);
+        snprintf(name, sizeof(name), "sha512_Raw %zu bytes", size);
+        bench_report(name, iters, sha512_time.seconds(), (uint64_t)size * iters);
+    }
+}
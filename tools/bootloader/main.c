@@ -334,6 +334,9 @@ int main(int argc, char *argv[])
         boot();
     }
 
+    /* Let the host see the last reply before the USB peripheral goes away */
+    usb_flush();
+
 #if DEBUG_LINK
     board_reset();
 #else
@@ -26,6 +26,7 @@
 #include "keepkey/board/memory.h"
 #include "keepkey/board/msg_dispatch.h"
 #include "keepkey/board/pubkeys.h"
+#include "keepkey/board/upload_session.h"
 #include "keepkey/board/usb_driver.h"
 #include "keepkey/bootloader/signatures.h"
 #include "keepkey/bootloader/usb_flash.h"
@@ -33,7 +34,11 @@
 #include "keepkey/crypto/macros.h"
 #include "keepkey/transport/interface.h"
 
-#include <libopencm3/stm32/flash.h>
+#ifndef EMULATOR
+#  include <libopencm3/stm32/flash.h>
+#else
+#  include "keepkey/board/flash_sim.h"
+#endif
 
 #include <assert.h>
 #include <inttypes.h>
@@ -48,42 +53,29 @@ static Allocation storage_location = FLASH_INVALID;
 static RawMessageState upload_state = RAW_MESSAGE_NOT_STARTED;
 static uint8_t CONFIDENTIAL storage_sav[STOR_FLASH_SECT_LEN];
 static uint8_t firmware_hash[SHA256_DIGEST_LENGTH];
+static UploadSession upload_session;
+static bool upload_verified = false;
 static bool old_firmware_was_unsigned;
 extern bool reset_msg_stack;
 
 static const MessagesMap_t MessagesMap[] =
 {
-    /* Normal Messages */
-    MSG_IN(MessageType_MessageType_Initialize,              Initialize_fields,          (message_handler_t)(handler_initialize), AnyVariant)
-    MSG_IN(MessageType_MessageType_GetFeatures,             GetFeatures_fields,         (message_handler_t)(handler_get_features), AnyVariant)
-    MSG_IN(MessageType_MessageType_Ping,                    Ping_fields,                (message_handler_t)(handler_ping), AnyVariant)
-    MSG_IN(MessageType_MessageType_WipeDevice,              WipeDevice_fields,          (message_handler_t)(handler_wipe), AnyVariant)
-    MSG_IN(MessageType_MessageType_FirmwareErase,           FirmwareErase_fields,       (message_handler_t)(handler_erase), AnyVariant)
-    MSG_IN(MessageType_MessageType_ButtonAck,               ButtonAck_fields,           NO_PROCESS_FUNC, AnyVariant)
-    MSG_IN(MessageType_MessageType_Cancel,                  Cancel_fields,              NO_PROCESS_FUNC, AnyVariant)
-
-    /* Normal Raw Messages */
-    RAW_IN(MessageType_MessageType_FirmwareUpload,          FirmwareUpload_fields,      (message_handler_t)(raw_handler_upload), AnyVariant)
-
-    /* Normal Out Messages */
-    MSG_OUT(MessageType_MessageType_Features,               Features_fields,            NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_Success,                Success_fields,             NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_Failure,                Failure_fields,             NO_PROCESS_FUNC, AnyVariant)
-    MSG_OUT(MessageType_MessageType_ButtonRequest,          ButtonRequest_fields,       NO_PROCESS_FUNC, AnyVariant)
-
-#if DEBUG_LINK
-    /* Debug Messages */
-    DEBUG_IN(MessageType_MessageType_DebugLinkDecision,     DebugLinkDecision_fields,   NO_PROCESS_FUNC, AnyVariant)
-    DEBUG_IN(MessageType_MessageType_DebugLinkGetState,     DebugLinkGetState_fields,   (message_handler_t)(handler_debug_link_get_state), AnyVariant)
-    DEBUG_IN(MessageType_MessageType_DebugLinkStop,         DebugLinkStop_fields,       (message_handler_t)(handler_debug_link_stop), AnyVariant)
-    DEBUG_IN(MessageType_MessageType_DebugLinkFillConfig,   DebugLinkFillConfig_fields, (message_handler_t)(handler_debug_link_fill_config), AnyVariant)
-
-    /* Debug Out Messages */
-    DEBUG_OUT(MessageType_MessageType_DebugLinkState,       DebugLinkState_fields,      NO_PROCESS_FUNC, AnyVariant)
-    DEBUG_OUT(MessageType_MessageType_DebugLinkLog,         DebugLinkLog_fields,        NO_PROCESS_FUNC, AnyVariant)
-#endif
+#include "keepkey/bootloader/messagemap.def"
 };
 
+/* Every parsable incoming message, so the decode buffer fits the largest */
+typedef union
+{
+#define MSG_IN(NAME, PROCESS_FUNC, MSG_PERMS) MSG_DECODE_MEMBER(NAME, PROCESS_FUNC, MSG_PERMS)
+#define DEBUG_IN(NAME, PROCESS_FUNC, MSG_PERMS) MSG_DECODE_MEMBER(NAME, PROCESS_FUNC, MSG_PERMS)
+#include "keepkey/bootloader/messagemap.def"
+} DecodeBuffer;
+
+_Static_assert(sizeof(DecodeBuffer) <= MAX_DECODE_SIZE,
+               "Largest incoming message exceeds MAX_DECODE_SIZE");
+
+static DecodeBuffer decode_buffer;
+
 /* === Private Functions =================================================== */
 
 /*
@@ -115,7 +107,8 @@ static bool check_firmware_hash(void)
  */
 static void bootloader_fsm_init(void)
 {
-    msg_map_init(MessagesMap, sizeof(MessagesMap) / sizeof(MessagesMap_t));
+    msg_map_init(MessagesMap, sizeof(MessagesMap) / sizeof(MessagesMap_t),
+                 &decode_buffer, sizeof(decode_buffer));
     set_msg_failure_handler(&send_failure);
 
 #if DEBUG_LINK
@@ -261,8 +254,9 @@ bool usb_flash_firmware(void)
                     }
                 }
 
-                /* Check CRC of firmware that was flashed */
-                if(check_firmware_hash())
+                /* Check hash of firmware that was flashed.  Chunked uploads
+                   were hashed as they arrived. */
+                if(upload_verified || check_firmware_hash())
                 {
                     /* Fingerprint has been verified.  Install "KPKY" magic in meta header */
                     if(flash_locking_write(FLASH_APP, 0, META_MAGIC_SIZE, (uint8_t *)META_MAGIC_STR) == true)
@@ -561,6 +555,9 @@ void handler_erase(FirmwareErase *msg)
             /* Erase application section */
             flash_erase_word(FLASH_APP);
             flash_lock();
+
+            /* Nothing of an earlier upload is left to resume */
+            upload_session_clear(&upload_session);
             send_success("Firmware erased");
 
             layout_loading();
@@ -599,6 +596,12 @@ void raw_handler_upload(RawMessage *msg, uint32_t frame_length)
     /* Check file size is within allocated space */
     if(frame_length < (FLASH_APP_LEN + FLASH_META_DESC_LEN))
     {
+        if(upload_session.active)
+        {
+            send_failure(FailureType_Failure_FirmwareError, "Chunked upload in progress");
+            goto rhu_exit;
+        }
+
         /* Start firmware load */
         if(upload_state == RAW_MESSAGE_NOT_STARTED)
         {
@@ -689,6 +692,168 @@ rhu_exit:
     return;
 }
 
+/*
+ * send_upload_ack() - Tell the host where a chunked upload continues from
+ *
+ * INPUT
+ *     - offset: image offset of the next chunk
+ * OUTPUT
+ *     none
+ */
+static void send_upload_ack(uint32_t offset)
+{
+    RESP_INIT(FirmwareUploadAck);
+
+    resp.offset = offset;
+
+    msg_write(MessageType_MessageType_FirmwareUploadAck, &resp);
+}
+
+/*
+ * handler_upload_start() - Handler to begin or resume a chunked firmware
+ * upload, including one that a reset interrupted
+ *
+ * INPUT
+ *     - msg: firmware upload start protocol buffer message
+ * OUTPUT
+ *     none
+ */
+void handler_upload_start(FirmwareUploadStart *msg)
+{
+    /* A single-message upload is already writing to flash */
+    if(upload_state != RAW_MESSAGE_NOT_STARTED && !upload_session.active)
+    {
+        send_failure(FailureType_Failure_FirmwareError, "Upload in progress");
+        return;
+    }
+
+    if(msg->hash.size != SHA256_DIGEST_LENGTH)
+    {
+        send_failure(FailureType_Failure_FirmwareError, "Invalid firmware hash");
+        return;
+    }
+
+    /* Shorter than its meta header can't be an image */
+    if(msg->length < FLASH_META_DESC_LEN)
+    {
+        send_failure(FailureType_Failure_FirmwareError, "Invalid firmware length");
+        return;
+    }
+
+    bool in_progress = upload_session.active;
+
+    if(!upload_session_start(&upload_session, msg->hash.bytes, msg->length,
+                             FLASH_APP_LEN + FLASH_META_DESC_LEN))
+    {
+        send_failure(FailureType_Failure_FirmwareError, "Firmware too large");
+        return;
+    }
+
+    /* First start since a reset: continue from what flash already holds.
+       An image other than the one in flash fails its hash check, so a
+       host starting a different image erases first. */
+    if(!in_progress)
+    {
+        uintptr_t app = flash_write_helper(FLASH_APP);
+        upload_session_rebuild(&upload_session, (const uint8_t *)app);
+    }
+
+    upload_state = RAW_MESSAGE_STARTED;
+    send_upload_ack(upload_session.offset);
+}
+
+/*
+ * handler_upload_chunk() - Handler for one chunk of a chunked firmware
+ * upload.  The chunk is acknowledged before it is programmed, so the host
+ * is already sending the next one while flash is busy.
+ *
+ * INPUT
+ *     - msg: firmware upload chunk protocol buffer message
+ * OUTPUT
+ *     none
+ */
+void handler_upload_chunk(FirmwareUploadChunk *msg)
+{
+    uint32_t offset = msg->offset;
+    uint8_t *data = msg->payload.bytes;
+    uint32_t len = msg->payload.size;
+
+    switch(upload_session_chunk(&upload_session, offset, data, len))
+    {
+        case UPLOAD_CHUNK_NEW:
+            break;
+
+        case UPLOAD_CHUNK_REPEAT:
+            send_upload_ack(upload_session.offset);
+            return;
+
+        case UPLOAD_CHUNK_INVALID:
+        default:
+            send_failure(FailureType_Failure_FirmwareError, "Invalid firmware chunk");
+            return;
+    }
+
+    if(!upload_session_done(&upload_session))
+    {
+        send_upload_ack(upload_session.offset);
+    }
+
+    /* The magic is only written once the whole image checks out */
+    if(offset == 0)
+    {
+        offset += META_MAGIC_SIZE;
+        data += META_MAGIC_SIZE;
+        len -= META_MAGIC_SIZE;
+    }
+
+    /* The write reads back every word it programs */
+    if(!flash_locking_write(FLASH_APP, offset, len, data))
+    {
+        upload_session_clear(&upload_session);
+        upload_state = RAW_MESSAGE_ERROR;
+        send_failure(FailureType_Failure_FirmwareError,
+                     "Encountered error while writing to flash");
+        return;
+    }
+
+    if(upload_session_done(&upload_session))
+    {
+        upload_verified = upload_session_verify(&upload_session);
+
+        if(upload_verified)
+        {
+            upload_state = RAW_MESSAGE_COMPLETE;
+        }
+        else
+        {
+            upload_state = RAW_MESSAGE_ERROR;
+            send_failure(FailureType_Failure_FirmwareError, "Firmware hash mismatch");
+        }
+    }
+}
+
+#ifdef EMULATOR
+/*
+ * usb_flash_reset_upload() - Forget the upload that just ran, so the bench
+ * can push another image through the same handlers
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false whether that upload completed and verified
+ */
+bool usb_flash_reset_upload(void)
+{
+    bool ret_val = upload_state == RAW_MESSAGE_COMPLETE && upload_verified;
+
+    upload_session_clear(&upload_session);
+    upload_state = RAW_MESSAGE_NOT_STARTED;
+    upload_verified = false;
+
+    return(ret_val);
+}
+#endif
+
 /* --- Debug Message Handlers ---------------------------------------------- */
 
 #if DEBUG_LINK
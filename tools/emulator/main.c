@@ -0,0 +1,99 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "keepkey/board/flash_sim.h"
+#include "keepkey/board/keepkey_board.h"
+#include "keepkey/board/memory.h"
+#include "keepkey/board/usb_driver.h"
+#include "keepkey/firmware/fsm.h"
+#include "keepkey/firmware/storage.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* === Functions =========================================================== */
+
+/*
+ * main() - Emulator entry: run the firmware message loop over the localhost
+ * UDP transport
+ *
+ * INPUT
+ *     - argc/argv: optional "--record <file>" to log received reports and
+ *       "--flash <file>" to keep flash (and so storage) across runs
+ * OUTPUT
+ *     0 when complete
+ */
+int main(int argc, char *argv[])
+{
+    const char *flash_path = NULL;
+
+    for(int i = 1; i < argc; i += 2)
+    {
+        if(i + 1 < argc && strcmp(argv[i], "--record") == 0)
+        {
+            if(!usb_record(argv[i + 1]))
+            {
+                fprintf(stderr, "cannot open %s\n", argv[i + 1]);
+                return(1);
+            }
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "--flash") == 0)
+        {
+            flash_path = argv[i + 1];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--record <file>] [--flash <file>]\n", argv[0]);
+            return(1);
+        }
+    }
+
+    if(!flash_sim_init(flash_path))
+    {
+        fprintf(stderr, "cannot map flash at 0x%08x\n", FLASH_ORIGIN);
+        return(1);
+    }
+
+    board_init();
+    storage_init();
+
+    fsm_init();
+
+    if(!usb_init())
+    {
+        fprintf(stderr, "cannot bind UDP port %d\n", EMULATOR_UDP_PORT);
+        return(1);
+    }
+
+    printf("listening on 127.0.0.1:%d\n", EMULATOR_UDP_PORT);
+    fflush(stdout);
+
+    while(1)
+    {
+        usb_poll();
+
+        /* There is no timer tick here, so deferred commits go out as soon
+           as the reply has */
+        storage_flush();
+    }
+
+    return(0);
+}
@@ -0,0 +1,215 @@
+#include "keepkey/board/usb_driver.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef std::vector<uint8_t> Report;
+
+/// One host message: its reports and how many reply messages it produces.
+struct Request {
+    std::vector<Report> reports;
+    unsigned replies = 1;
+};
+
+static bool parse_hex(const std::string &hex, Report &out) {
+    if (hex.size() % 2)
+        return false;
+    out.clear();
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        char byte[3] = { hex[i], hex[i + 1], 0 };
+        char *end;
+        out.push_back((uint8_t)strtoul(byte, &end, 16));
+        if (*end)
+            return false;
+    }
+    return true;
+}
+
+static uint32_t frame_length(const Report &r) {
+    return ((uint32_t)r[5] << 24) | ((uint32_t)r[6] << 16) |
+           ((uint32_t)r[7] << 8) | r[8];
+}
+
+static bool is_first_report(const Report &r) {
+    return r.size() >= 9 && r[0] == '?' && r[1] == '#' && r[2] == '#';
+}
+
+/// Load a session: one hex encoded report per line, as written by the
+/// emulator's --record option. A first report may end in " x<N>" when its
+/// message gets N replies. Blank lines and lines starting with '#' are
+/// ignored.
+static bool load_session(const char *path, std::vector<Request> &session) {
+    std::ifstream in(path);
+    std::string line;
+    uint32_t remaining = 0;
+    int lineno = 0;
+
+    if (!in)
+        return false;
+
+    while (std::getline(in, line)) {
+        lineno++;
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        unsigned replies = 1;
+        size_t space = line.find(' ');
+        if (space != std::string::npos) {
+            if (line.compare(space, 2, " x") == 0)
+                replies = atoi(line.c_str() + space + 2);
+            line.resize(space);
+        }
+
+        Report report;
+        if (!parse_hex(line, report) || report.empty() ||
+            report.size() > USB_SEGMENT_SIZE) {
+            fprintf(stderr, "%s:%d: bad report\n", path, lineno);
+            return false;
+        }
+        report.resize(USB_SEGMENT_SIZE);
+
+        if (remaining == 0) {
+            if (!is_first_report(report)) {
+                fprintf(stderr, "%s:%d: expected a message header\n", path, lineno);
+                return false;
+            }
+            session.push_back(Request());
+            session.back().replies = replies;
+            uint32_t len = frame_length(report);
+            remaining = len > USB_SEGMENT_SIZE - 9 ? len - (USB_SEGMENT_SIZE - 9) : 0;
+        } else {
+            remaining -= std::min<uint32_t>(remaining, USB_SEGMENT_SIZE - 1);
+        }
+        session.back().reports.push_back(report);
+    }
+
+    return remaining == 0;
+}
+
+/// Read reports until one whole reply message has arrived.
+static bool receive_message(int fd, int timeout_ms) {
+    uint32_t remaining = 0;
+    bool started = false;
+
+    while (!started || remaining > 0) {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, timeout_ms) <= 0)
+            return false;
+
+        Report report(USB_SEGMENT_SIZE);
+        ssize_t rx = recv(fd, report.data(), report.size(), 0);
+        if (rx != USB_SEGMENT_SIZE)
+            return false;
+
+        if (!started) {
+            if (!is_first_report(report))
+                continue;
+            started = true;
+            uint32_t len = frame_length(report);
+            remaining = len > USB_SEGMENT_SIZE - 9 ? len - (USB_SEGMENT_SIZE - 9) : 0;
+        } else {
+            remaining -= std::min<uint32_t>(remaining, USB_SEGMENT_SIZE - 1);
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int port = EMULATOR_UDP_PORT;
+    int rounds = 1;
+    int timeout_ms = 5000;
+    const char *path = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+            port = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+            rounds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--timeout") == 0 && i + 1 < argc)
+            timeout_ms = atoi(argv[++i]);
+        else if (!path)
+            path = argv[i];
+        else
+            path = nullptr, i = argc;
+    }
+
+    if (!path || rounds < 1) {
+        fprintf(stderr, "usage: %s [--port N] [--rounds N] [--timeout ms] <session>\n",
+                argv[0]);
+        return 1;
+    }
+
+    std::vector<Request> session;
+    if (!load_session(path, session) || session.empty()) {
+        fprintf(stderr, "cannot load session %s\n", path);
+        return 1;
+    }
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        perror("connect");
+        return 1;
+    }
+
+    std::vector<double> latency;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < rounds; round++) {
+        for (size_t m = 0; m < session.size(); m++) {
+            const Request &req = session[m];
+            auto sent = std::chrono::steady_clock::now();
+
+            for (const Report &report : req.reports) {
+                if (send(fd, report.data(), report.size(), 0) != (ssize_t)report.size()) {
+                    perror("send");
+                    return 1;
+                }
+            }
+
+            for (unsigned r = 0; r < req.replies; r++) {
+                if (!receive_message(fd, timeout_ms)) {
+                    fprintf(stderr, "message %zu of round %d: no reply\n", m, round);
+                    return 1;
+                }
+            }
+
+            latency.push_back(std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - sent).count());
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::sort(latency.begin(), latency.end());
+    auto pct = [&](double p) {
+        return latency[std::min(latency.size() - 1, (size_t)(p * latency.size()))];
+    };
+
+    printf("%zu messages in %.3f s: %.1f msg/s\n", latency.size(), seconds,
+           latency.size() / seconds);
+    printf("latency us: min %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+           latency.front(), pct(0.5), pct(0.9), pct(0.99), latency.back());
+
+    close(fd);
+    return 0;
+}
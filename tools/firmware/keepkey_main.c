@@ -65,6 +65,9 @@ static void exec(void)
 {
     usb_poll();
 
+    /* Deferred storage commits run here, outside the timer interrupt */
+    storage_poll();
+
     /* Attempt to animate should a screensaver be present */
     animate();
     display_refresh();
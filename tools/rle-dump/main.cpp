@@ -1,9 +1,12 @@
 extern "C" {
 #include "keepkey/board/canvas.h"
 #include "keepkey/board/draw.h"
+#include "keepkey/board/resources.h"
 #include "keepkey/board/variant.h"
 }
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 
@@ -33,7 +36,7 @@ void to_ppm(Canvas *canvas) {
 
     for (uint16_t y = 0; y < canvas->height; y++) {
         for (uint16_t x = 0; x < canvas->width; x++) {
-            int color = canvas->buffer[y * canvas->width + x];
+            int color = canvas_get_pixel(canvas, x, y);
             std::cout << std::setw(4) << color;
             if (x + 1 == canvas->width)
                 std::cout << "\n";
@@ -45,13 +48,33 @@ int main(int argc, char *argv[]) {
     Canvas canvas;
     canvas.height = 64;
     canvas.width = 256;
-    canvas.buffer = new uint8_t[64 * 255];
+    canvas.buffer = new uint8_t[64 * CANVAS_STRIDE(256)];
+    canvas_clean(&canvas);
 
-    memset(canvas.buffer, 0, 64 * 255);
+    memset(canvas.buffer, 0, 64 * CANVAS_STRIDE(256));
 
     if (!canvas.buffer)
         return 1;
 
+    // rle-dump confirming|loading <frame>: replay the deltas up to a frame
+    if (argc == 3) {
+        const DeltaAnimation *animation =
+            !strcmp(argv[1], "confirming") ? get_confirming_animation() :
+            !strcmp(argv[1], "loading") ? get_loading_animation() : nullptr;
+        int frame = atoi(argv[2]);
+
+        if (!animation || frame < 0 || frame >= animation->count)
+            return 3;
+
+        for (int i = 0; i <= frame; i++) {
+            if (!draw_delta_frame(&canvas, animation, i))
+                return 2;
+        }
+
+        to_ppm(&canvas);
+        return 0;
+    }
+
     if (draw_bitmap_mono_rle(&canvas, &confirm_icon_1_frame, false)) {
         to_ppm(&canvas);
         return 0;
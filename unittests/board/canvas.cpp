@@ -0,0 +1,95 @@
+extern "C" {
+#include "keepkey/board/canvas.h"
+#include "keepkey/board/draw.h"
+#include "keepkey/board/keepkey_display.h"
+#include "keepkey/board/resources.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+TEST(Canvas, PackedPixels) {
+    uint8_t buffer[CANVAS_STRIDE(8) * 2];
+    Canvas canvas;
+    canvas.buffer = buffer;
+    canvas.width = 8;
+    canvas.height = 2;
+    canvas_clean(&canvas);
+    memset(buffer, 0, sizeof(buffer));
+
+    // Left pixel in the high nibble, as the display takes it.
+    canvas_set_pixel(&canvas, 0, 0, 0xF0);
+    canvas_set_pixel(&canvas, 1, 0, 0x3C);
+    EXPECT_EQ(buffer[0], 0xF3);
+    EXPECT_EQ(canvas_get_pixel(&canvas, 0, 0), 0xFF);
+    EXPECT_EQ(canvas_get_pixel(&canvas, 1, 0), 0x33);
+
+    // Odd edges keep their neighbours; the fill is clipped to the canvas.
+    canvas_fill(&canvas, 1, 1, 6, 5, 0xA0);
+    const uint8_t row[] = { 0x0A, 0xAA, 0xAA, 0xA0 };
+    EXPECT_EQ(memcmp(buffer + CANVAS_STRIDE(8), row, sizeof(row)), 0);
+    EXPECT_FALSE(canvas.dirty);
+}
+
+TEST(Canvas, DirtyBox) {
+    Canvas *canvas = display_canvas_init();
+    display_refresh();
+    EXPECT_FALSE(canvas->dirty);
+
+    draw_box_simple(canvas, 0xFF, 10, 20, 4, 4);
+    canvas_mark_dirty(canvas, 12, 30, 1, 2);
+    EXPECT_TRUE(canvas->dirty);
+    EXPECT_EQ(canvas->dirty_left, 10);
+    EXPECT_EQ(canvas->dirty_top, 20);
+    EXPECT_EQ(canvas->dirty_right, 14);
+    EXPECT_EQ(canvas->dirty_bottom, 32);
+
+    // Columns 8..16 of rows 20..32, after the window and write commands.
+    uint32_t before = display_bytes_written();
+    display_refresh();
+    EXPECT_EQ(display_bytes_written() - before, 7u + 12u * 4u);
+    EXPECT_FALSE(canvas->dirty);
+
+    before = display_bytes_written();
+    display_refresh();
+    EXPECT_EQ(display_bytes_written(), before);
+}
+
+TEST(Display, BurstRefresh) {
+    Canvas *canvas = display_canvas_init();
+    canvas_mark_dirty(canvas, 0, 0, canvas->width, canvas->height);
+
+    // The SSD1322 write cycle is 300ns, 36 cycles at 120 MHz.  The burst
+    // runs at that rate, with little besides the GRAM bytes on the bus.
+    uint64_t before = display_bus_cycles();
+    display_refresh();
+    uint64_t cycles = display_bus_cycles() - before;
+    EXPECT_GE(cycles, 8192u * 36u);
+    EXPECT_LT(cycles, 8192u * 37u);
+}
+
+TEST(Canvas, DeltaAnimation) {
+    Canvas *canvas = display_canvas_init();
+    const DeltaAnimation *loading = get_loading_animation();
+    canvas_fill(canvas, 0, 0, canvas->width, canvas->height, 0x00);
+    display_refresh();
+
+    // Only the box around the changed pixels is marked.
+    for (uint16_t frame = 0; frame < 2; frame++) {
+        const DeltaFrame *delta = &loading->frames[frame];
+        ASSERT_TRUE(draw_delta_frame(canvas, loading, frame));
+        EXPECT_EQ(canvas->dirty_left, loading->x + delta->left);
+        EXPECT_EQ(canvas->dirty_top, loading->y + delta->top);
+        EXPECT_EQ(canvas->dirty_right, loading->x + delta->left + delta->width);
+        EXPECT_EQ(canvas->dirty_bottom, loading->y + delta->top + delta->height);
+        display_refresh();
+    }
+
+    EXPECT_FALSE(draw_delta_frame(canvas, loading, loading->count));
+    EXPECT_EQ(get_delta_animation_frame(loading, 0, true), 0);
+    EXPECT_EQ(get_delta_animation_frame(loading, loading->duration + 1, true), 1);
+    EXPECT_EQ(get_delta_animation_frame(loading,
+                                        get_delta_animation_duration(loading) + 1,
+                                        false), -1);
+}
@@ -0,0 +1,61 @@
+extern "C" {
+#include "keepkey/board/flash_sim.h"
+#include "keepkey/board/keepkey_flash.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+TEST(FlashSim, ProgramClearsBits) {
+    ASSERT_TRUE(flash_sim_init(NULL));
+    const uint8_t *stor = (const uint8_t *)flash_write_helper(FLASH_STORAGE1);
+    EXPECT_EQ(stor[0], 0xFF);
+
+    uint8_t data[6] = { 0x0F, 0xF0, 0x12, 0x34, 0x56, 0x78 };
+
+    // Locked flash refuses to program and latches an error.
+    EXPECT_FALSE(flash_write_word(FLASH_STORAGE1, 1, sizeof(data), data));
+    EXPECT_EQ(stor[1], 0xFF);
+    flash_clear_status_flags();
+
+    flash_unlock();
+    EXPECT_TRUE(flash_write_word(FLASH_STORAGE1, 1, sizeof(data), data));
+    EXPECT_EQ(memcmp(stor + 1, data, sizeof(data)), 0);
+
+    // Programming again can only clear more bits, and the read back catches
+    // the bits that stayed clear.
+    uint8_t again[1] = { 0xF3 };
+    EXPECT_FALSE(flash_write(FLASH_STORAGE1, 1, sizeof(again), again));
+    EXPECT_EQ(stor[1], 0x03);
+
+    // Data flash already holds is not programmed again.
+    EXPECT_TRUE(flash_write_word(FLASH_STORAGE1, 2, sizeof(data) - 1, data + 1));
+
+    flash_erase_word(FLASH_STORAGE1);
+    EXPECT_EQ(stor[1], 0xFF);
+    flash_lock();
+
+    FlashSimStats stats;
+    flash_sim_stats(&stats);
+    EXPECT_EQ(stats.erases[1], 1u);
+    EXPECT_EQ(stats.erases[2], 0u);
+    EXPECT_EQ(stats.overwrites, 1u);
+    EXPECT_EQ(stats.bytes_programmed, sizeof(data) + sizeof(again));
+    EXPECT_EQ(stats.busy_us, 250000u + 16u * stats.program_ops);
+
+    flash_sim_close();
+}
+
+TEST(FlashSim, Alignment) {
+    ASSERT_TRUE(flash_sim_init(NULL));
+    flash_unlock();
+
+    flash_program_word(flash_write_helper(FLASH_STORAGE2) + 2, 0);
+    EXPECT_FALSE(flash_chk_status());
+    flash_clear_status_flags();
+    EXPECT_TRUE(flash_chk_status());
+
+    flash_lock();
+    flash_sim_close();
+}
@@ -0,0 +1,62 @@
+extern "C" {
+#include "keepkey/board/font.h"
+#include "keepkey/board/text_layout.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+TEST(TextLayout, LineBreaks) {
+    const Font *font = get_body_font();
+    const char *str = "  ab cd\nef";
+    uint16_t ab = calc_str_width(font, "ab");
+    uint16_t space = calc_str_width(font, " ");
+
+    // "ab cd" does not fit, so the space before "cd" wraps and is dropped.
+    const TextLayout *layout = text_layout(font, str, ab + space + 1);
+    ASSERT_EQ(layout->count, 3u);
+    EXPECT_EQ(layout->lines[0].offset, 2u);
+    EXPECT_EQ(layout->lines[0].length, 2u);
+    EXPECT_EQ(layout->lines[0].width, ab);
+    EXPECT_EQ(layout->lines[1].offset, 5u);
+    EXPECT_EQ(layout->lines[1].length, 2u);
+    EXPECT_EQ(layout->lines[2].offset, 8u);
+    EXPECT_EQ(layout->lines[2].length, 2u);
+
+    // Without a width only '\n' breaks.
+    EXPECT_EQ(text_layout(font, str, 0)->count, 2u);
+    EXPECT_EQ(calc_str_line(font, str, 256), 2u);
+}
+
+TEST(TextLayout, Cached) {
+    const Font *font = get_title_font();
+    char str[32];
+    strcpy(str, "CONFIRM ADDRESS");
+
+    const TextLayout *layout = text_layout(font, str, 60);
+    EXPECT_EQ(text_layout(font, str, 60), layout);
+    EXPECT_EQ(calc_str_line(font, str, 60), layout->count);
+
+    // The key is the string contents, not its address.
+    str[0] = 'X';
+    EXPECT_NE(text_layout(font, str, 60), layout);
+}
+
+TEST(TextLayout, LongStrings) {
+    char str[600];
+    memset(str, 'W', sizeof(str) - 1);
+    str[sizeof(str) - 1] = '\0';
+
+    // Every glyph is wider than the line, so each gets a line of its own
+    // after an empty first one; counting goes on past the table.
+    const TextLayout *layout = text_layout(get_body_font(), str, 1);
+    EXPECT_EQ(layout->count, sizeof(str));
+    EXPECT_EQ(layout->lines[0].length, 0u);
+    EXPECT_EQ(layout->lines[1].length, 1u);
+
+    // Too long to keep a copy of, so it is laid out again on every call.
+    EXPECT_EQ(text_layout(get_body_font(), str, 0)->count, 1u);
+    str[300] = '\n';
+    EXPECT_EQ(text_layout(get_body_font(), str, 0)->count, 2u);
+}
@@ -0,0 +1,155 @@
+extern "C" {
+#include "keepkey/board/memory.h"
+#include "keepkey/board/upload_session.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+static std::vector<uint8_t> test_image(uint32_t code_len, uint32_t padding) {
+    std::vector<uint8_t> image(FLASH_META_DESC_LEN + code_len + padding);
+    for (size_t i = 0; i < image.size(); i++)
+        image[i] = i * 13;
+    memcpy(image.data(), META_MAGIC_STR, META_MAGIC_SIZE);
+    memcpy(image.data() + META_MAGIC_SIZE, &code_len, sizeof(code_len));
+    return image;
+}
+
+static void image_hash(const std::vector<uint8_t> &image, uint32_t code_len,
+                       uint8_t hash[SHA256_DIGEST_LENGTH]) {
+    sha256_Raw(image.data(), FLASH_META_DESC_LEN + code_len, hash);
+}
+
+TEST(UploadSession, InOrder) {
+    const uint32_t code_len = 5000;
+    std::vector<uint8_t> image = test_image(code_len, 300);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    image_hash(image, code_len, hash);
+
+    UploadSession session;
+    upload_session_clear(&session);
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    EXPECT_EQ(session.offset, 0u);
+
+    for (uint32_t off = 0; off < image.size(); off += UPLOAD_CHUNK_SIZE) {
+        uint32_t len = std::min<uint32_t>(UPLOAD_CHUNK_SIZE, image.size() - off);
+        EXPECT_FALSE(upload_session_done(&session));
+        ASSERT_EQ(upload_session_chunk(&session, off, &image[off], len),
+                  UPLOAD_CHUNK_NEW);
+    }
+
+    EXPECT_TRUE(upload_session_done(&session));
+    EXPECT_TRUE(upload_session_verify(&session));
+    EXPECT_FALSE(session.active);
+}
+
+TEST(UploadSession, Resume) {
+    const uint32_t code_len = 3000;
+    std::vector<uint8_t> image = test_image(code_len, 0);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    image_hash(image, code_len, hash);
+
+    UploadSession session;
+    upload_session_clear(&session);
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    ASSERT_EQ(upload_session_chunk(&session, 0, &image[0], 1000), UPLOAD_CHUNK_NEW);
+    ASSERT_EQ(upload_session_chunk(&session, 1000, &image[1000], 1000), UPLOAD_CHUNK_NEW);
+
+    // The host lost the last acknowledgement and sends the chunk again.
+    EXPECT_EQ(upload_session_chunk(&session, 1000, &image[1000], 1000), UPLOAD_CHUNK_REPEAT);
+
+    // Gaps and overlaps are refused.
+    EXPECT_EQ(upload_session_chunk(&session, 2500, &image[2500], 100), UPLOAD_CHUNK_INVALID);
+    EXPECT_EQ(upload_session_chunk(&session, 1500, &image[1500], 1000), UPLOAD_CHUNK_INVALID);
+
+    // Reconnecting with the same image picks up where it left off.
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    EXPECT_EQ(session.offset, 2000u);
+
+    for (uint32_t off = 2000; off < image.size(); off += 1000) {
+        uint32_t len = std::min<uint32_t>(1000, image.size() - off);
+        ASSERT_EQ(upload_session_chunk(&session, off, &image[off], len), UPLOAD_CHUNK_NEW);
+    }
+    EXPECT_TRUE(upload_session_verify(&session));
+
+    // A different image starts over.
+    uint8_t other[SHA256_DIGEST_LENGTH] = { 1 };
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    ASSERT_EQ(upload_session_chunk(&session, 0, &image[0], 1000), UPLOAD_CHUNK_NEW);
+    ASSERT_TRUE(upload_session_start(&session, other, image.size(), 1 << 20));
+    EXPECT_EQ(session.offset, 0u);
+}
+
+TEST(UploadSession, Reject) {
+    const uint32_t code_len = 2000;
+    std::vector<uint8_t> image = test_image(code_len, 0);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    image_hash(image, code_len, hash);
+
+    UploadSession session;
+    upload_session_clear(&session);
+    EXPECT_FALSE(upload_session_start(&session, hash, image.size(), image.size() - 1));
+
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    EXPECT_EQ(upload_session_chunk(&session, 0, &image[0], UPLOAD_CHUNK_SIZE + 1),
+              UPLOAD_CHUNK_INVALID);
+
+    // Wrong magic
+    std::vector<uint8_t> bad = image;
+    bad[0] ^= 1;
+    EXPECT_EQ(upload_session_chunk(&session, 0, &bad[0], 1000), UPLOAD_CHUNK_INVALID);
+
+    // Corrupted content is caught by the running hash.
+    bad = image;
+    bad[1500] ^= 1;
+    for (uint32_t off = 0; off < bad.size(); off += 1000) {
+        uint32_t len = std::min<uint32_t>(1000, bad.size() - off);
+        ASSERT_EQ(upload_session_chunk(&session, off, &bad[off], len), UPLOAD_CHUNK_NEW);
+    }
+    EXPECT_FALSE(upload_session_verify(&session));
+}
+
+TEST(UploadSession, Rebuild) {
+    const uint32_t code_len = 5000;
+    std::vector<uint8_t> image = test_image(code_len, 0);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    image_hash(image, code_len, hash);
+
+    // Flash as a reset left it: part of the image programmed, magic erased.
+    std::vector<uint8_t> flash(image.size() + 64, 0xff);
+    memcpy(&flash[META_MAGIC_SIZE], &image[META_MAGIC_SIZE], 2500 - META_MAGIC_SIZE);
+
+    UploadSession session;
+    upload_session_clear(&session);
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    upload_session_rebuild(&session, flash.data());
+
+    // The last programmed word is sent again.
+    EXPECT_EQ(session.offset, 2496u);
+
+    for (uint32_t off = session.offset; off < image.size(); off += 1000) {
+        uint32_t len = std::min<uint32_t>(1000, image.size() - off);
+        ASSERT_EQ(upload_session_chunk(&session, off, &image[off], len), UPLOAD_CHUNK_NEW);
+    }
+    EXPECT_TRUE(upload_session_verify(&session));
+
+    // A whole image still ends with a chunk, which completes the upload.
+    memcpy(&flash[META_MAGIC_SIZE], &image[META_MAGIC_SIZE], image.size() - META_MAGIC_SIZE);
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    upload_session_rebuild(&session, flash.data());
+    ASSERT_LT(session.offset, image.size());
+    ASSERT_EQ(upload_session_chunk(&session, session.offset, &image[session.offset],
+                                   image.size() - session.offset), UPLOAD_CHUNK_NEW);
+    EXPECT_TRUE(upload_session_verify(&session));
+
+    // Erased flash, and a finished image with its magic, leave nothing to resume.
+    std::vector<uint8_t> erased(image.size(), 0xff);
+    ASSERT_TRUE(upload_session_start(&session, hash, image.size(), 1 << 20));
+    upload_session_rebuild(&session, erased.data());
+    EXPECT_EQ(session.offset, 0u);
+
+    upload_session_rebuild(&session, image.data());
+    EXPECT_EQ(session.offset, 0u);
+}
@@ -0,0 +1,93 @@
+extern "C" {
+#include "keepkey/crypto/bip32.h"
+#include "keepkey/crypto/curves.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+TEST(Crypto, PublicCkdBatch) {
+    const size_t count = 2 * ECDSA_BATCH_SIZE + 3;
+    HDNode root, parents[2], expected[count], batch[count];
+    uint32_t index[count];
+    uint8_t seed[32];
+
+    memset(seed, 0x42, sizeof(seed));
+    ASSERT_EQ(hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &root), 1);
+    for (int p = 0; p < 2; p++) {
+        parents[p] = root;
+        ASSERT_EQ(hdnode_private_ckd_prime(&parents[p], p), 1);
+        hdnode_fill_public_key(&parents[p]);
+        memset(parents[p].private_key, 0, sizeof(parents[p].private_key));
+    }
+
+    // interleave two parents, as the cosigners of a multisig path would be
+    for (size_t j = 0; j < count; j++) {
+        index[j] = j * 7;
+        expected[j] = parents[j % 2];
+        batch[j] = parents[j % 2];
+        ASSERT_EQ(hdnode_public_ckd(&expected[j], index[j]), 1);
+    }
+    ASSERT_EQ(hdnode_public_ckd_batch(batch, index, count), 1);
+
+    for (size_t j = 0; j < count; j++) {
+        EXPECT_EQ(memcmp(batch[j].public_key, expected[j].public_key, 33), 0);
+        EXPECT_EQ(memcmp(batch[j].chain_code, expected[j].chain_code, 32), 0);
+        EXPECT_EQ(batch[j].depth, expected[j].depth);
+        EXPECT_EQ(batch[j].child_num, expected[j].child_num);
+    }
+
+    uint32_t hardened = 0x80000000;
+    HDNode node = parents[0];
+    EXPECT_EQ(hdnode_public_ckd_batch(&node, &hardened, 1), 0);
+}
+
+TEST(Crypto, PrivateCkdCached) {
+    // BTC, LTC and ETH accounts interleaved in one session, then a second
+    // root as after a passphrase change
+    static const uint32_t h = 0x80000000;
+    static const uint32_t paths[][5] = {
+        { 44 | h, 0 | h, 0 | h, 0, 0 },
+        { 44 | h, 2 | h, 0 | h, 0, 1 },
+        { 44 | h, 60 | h, 0 | h, 0, 0 },
+        { 44 | h, 0 | h, 0 | h, 0, 5 },
+        { 44 | h, 2 | h, 0 | h, 1, 3 },
+        { 44 | h, 60 | h, 0 | h, 0, 0 },
+    };
+    HDNode roots[2];
+    uint8_t seed[32];
+
+    hdnode_private_ckd_cache_clear();
+    for (int r = 0; r < 2; r++) {
+        memset(seed, 0x42 + r, sizeof(seed));
+        ASSERT_EQ(hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &roots[r]), 1);
+    }
+
+    // more roots and paths than the budget holds: results must not change
+    for (int pass = 0; pass < 3; pass++) {
+        for (int r = 0; r < 2; r++) {
+            for (const auto &path : paths) {
+                HDNode expected = roots[r], cached = roots[r];
+                for (uint32_t i : path)
+                    ASSERT_EQ(hdnode_private_ckd(&expected, i), 1);
+                ASSERT_EQ(hdnode_private_ckd_cached(&cached, path, 5), 1);
+                EXPECT_EQ(memcmp(&cached, &expected, sizeof(HDNode)), 0);
+            }
+        }
+    }
+
+    // with one root, only the first visit of each distinct parent path misses
+    hdnode_private_ckd_cache_clear();
+    uint32_t hits, misses;
+    hdnode_private_ckd_cache_stats(&hits, &misses);
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 0u);
+    for (const auto &path : paths) {
+        HDNode node = roots[0];
+        ASSERT_EQ(hdnode_private_ckd_cached(&node, path, 5), 1);
+    }
+    hdnode_private_ckd_cache_stats(&hits, &misses);
+    EXPECT_EQ(misses, 4u);
+    EXPECT_EQ(hits, 2u);
+}
@@ -0,0 +1,112 @@
+extern "C" {
+#include "keepkey/crypto/ecdsa.h"
+#include "keepkey/crypto/nist256p1.h"
+#include "keepkey/crypto/secp256k1.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+static void scalar_from_byte(const ecdsa_curve *curve, uint8_t seed, bignum256 *k) {
+    uint8_t buf[32];
+    for (int i = 0; i < 32; i++) {
+        buf[i] = seed * 31 + i * 17;
+    }
+    bn_read_be(buf, k);
+    bn_mod(k, &curve->order);
+}
+
+static void check_double_scalar(const ecdsa_curve *curve, const bignum256 *k1,
+                                const bignum256 *k2, const curve_point *p) {
+    curve_point expected, q, res;
+    scalar_multiply(curve, k1, &expected);
+    point_multiply(curve, k2, p, &q);
+    point_add(curve, &q, &expected);
+
+    ecdsa_double_scalar_multiply(curve, k1, k2, p, &res);
+    bn_mod(&res.x, &curve->prime);
+    bn_mod(&res.y, &curve->prime);
+    ASSERT_TRUE(point_is_equal(&res, &expected));
+}
+
+TEST(Crypto, DoubleScalarMultiply) {
+    const ecdsa_curve *curves[] = { &secp256k1, &nist256p1 };
+    for (const ecdsa_curve *curve : curves) {
+        bignum256 k1, k2, kp, zero, one, max;
+        curve_point p;
+        bn_zero(&zero);
+        bn_zero(&one);
+        one.val[0] = 1;
+        max = curve->order;
+        bn_subi(&max, 1, &curve->order);
+        bn_mod(&max, &curve->order);
+
+        for (uint8_t i = 1; i < 16; i++) {
+            scalar_from_byte(curve, i, &k1);
+            scalar_from_byte(curve, i + 100, &k2);
+            scalar_from_byte(curve, i + 200, &kp);
+            scalar_multiply(curve, &kp, &p);
+
+            check_double_scalar(curve, &k1, &k2, &p);
+            check_double_scalar(curve, &zero, &k2, &p);
+            check_double_scalar(curve, &k1, &zero, &p);
+            check_double_scalar(curve, &one, &k2, &p);
+            check_double_scalar(curve, &max, &k2, &p);
+            // p = G makes the two windows collide on equal digits.
+            check_double_scalar(curve, &k1, &k1, &curve->G);
+
+            // k1 * G + (order - k1) * G cancels to infinity.
+            curve_point res;
+            bn_subtract(&curve->order, &k1, &k2);
+            ecdsa_double_scalar_multiply(curve, &k1, &k2, &curve->G, &res);
+            ASSERT_TRUE(point_is_infinity(&res));
+        }
+    }
+}
+
+TEST(Crypto, VerifyRecover) {
+    const ecdsa_curve *curves[] = { &secp256k1, &nist256p1 };
+    for (const ecdsa_curve *curve : curves) {
+        uint8_t priv[32], pub[65], digest[32], sig[64], recovered[65], pby;
+        memset(priv, 0x37, sizeof(priv));
+        memset(digest, 0x55, sizeof(digest));
+        ecdsa_get_public_key65(curve, priv, pub);
+        ASSERT_EQ(ecdsa_sign_digest(curve, priv, digest, sig, &pby), 0);
+
+        EXPECT_EQ(ecdsa_verify_digest(curve, pub, sig, digest), 0);
+        ASSERT_EQ(ecdsa_verify_digest_recover(curve, recovered, sig, digest, pby), 0);
+        EXPECT_EQ(memcmp(recovered, pub, sizeof(pub)), 0);
+
+        digest[0] ^= 1;
+        EXPECT_NE(ecdsa_verify_digest(curve, pub, sig, digest), 0);
+    }
+}
+
+TEST(Crypto, FieldMultiplyReduce) {
+    const ecdsa_curve *curves[] = { &secp256k1, &nist256p1 };
+    for (const ecdsa_curve *curve : curves) {
+        bignum256 values[4], two_prime = curve->prime;
+        bn_add(&two_prime, &curve->prime);
+        values[0] = curve->G.x;
+        values[1] = curve->G.y;
+        values[2] = curve->prime;
+        // largest input bn_multiply accepts: just below 180 * prime
+        for (int i = 0; i < 8; i++) {
+            values[3].val[i] = 0x3FFFFFFF;
+        }
+        values[3].val[8] = 179 * 0xFFFF;
+
+        for (const bignum256 &k : values) {
+            for (const bignum256 &v : values) {
+                bignum256 expected = v, x = v;
+                bn_multiply(&k, &expected, &curve->prime);
+                bn_multiply_with(&k, &x, &curve->prime, curve->multiply_reduce);
+                ASSERT_TRUE(bn_is_less(&x, &two_prime));
+                bn_mod(&expected, &curve->prime);
+                bn_mod(&x, &curve->prime);
+                ASSERT_TRUE(bn_is_equal(&x, &expected));
+            }
+        }
+    }
+}
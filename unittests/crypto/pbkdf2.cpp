@@ -0,0 +1,39 @@
+extern "C" {
+#include "keepkey/crypto/bip39.h"
+#include "keepkey/crypto/pbkdf2.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+TEST(Crypto, PBKDF2HmacSha512) {
+    // BIP39 test vector: "abandon ... about" with passphrase "TREZOR"
+    static const char mnemonic[] =
+        "abandon abandon abandon abandon abandon abandon abandon abandon "
+        "abandon abandon abandon about";
+    static const char salt[] = "mnemonicTREZOR";
+    static const uint8_t expected[64] = {
+        0xc5, 0x52, 0x57, 0xc3, 0x60, 0xc0, 0x7c, 0x72, 0x02, 0x9a, 0xeb, 0xc1,
+        0xb5, 0x3c, 0x05, 0xed, 0x03, 0x62, 0xad, 0xa3, 0x8e, 0xad, 0x3e, 0x3e,
+        0x9e, 0xfa, 0x37, 0x08, 0xe5, 0x34, 0x95, 0x53, 0x1f, 0x09, 0xa6, 0x98,
+        0x75, 0x99, 0xd1, 0x82, 0x64, 0xc1, 0xe1, 0xc9, 0x2f, 0x2c, 0xf1, 0x41,
+        0x63, 0x0c, 0x7a, 0x3c, 0x4a, 0xb7, 0xc8, 0x1b, 0x2f, 0x00, 0x16, 0x98,
+        0xe7, 0x46, 0x3b, 0x04,
+    };
+    uint8_t key[64];
+
+    pbkdf2_hmac_sha512((const uint8_t *)mnemonic, strlen(mnemonic),
+                       (const uint8_t *)salt, strlen(salt),
+                       BIP39_PBKDF2_ROUNDS, key, NULL);
+    EXPECT_EQ(memcmp(key, expected, sizeof(key)), 0);
+
+    // resuming in chunks gives the same key
+    PBKDF2_HMAC_SHA512_CTX pctx;
+    pbkdf2_hmac_sha512_Init(&pctx, (const uint8_t *)mnemonic, strlen(mnemonic),
+                            (const uint8_t *)salt, strlen(salt));
+    for (int i = 0; i < 16; i++)
+        pbkdf2_hmac_sha512_Update(&pctx, BIP39_PBKDF2_ROUNDS / 16, NULL);
+    pbkdf2_hmac_sha512_Final(&pctx, key);
+    EXPECT_EQ(memcmp(key, expected, sizeof(key)), 0);
+}
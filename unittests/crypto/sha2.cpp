@@ -0,0 +1,62 @@
+extern "C" {
+#include "keepkey/crypto/sha2.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+static std::string hex(const uint8_t *data, size_t len) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+    for (size_t i = 0; i < len; i++) {
+        out += digits[data[i] >> 4];
+        out += digits[data[i] & 0xf];
+    }
+    return out;
+}
+
+TEST(Crypto, SHA2Vectors) {
+    static const char two_block[] =
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+
+    sha256_Raw((const uint8_t *)"abc", 3, digest);
+    EXPECT_EQ(hex(digest, SHA256_DIGEST_LENGTH),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    sha256_Raw((const uint8_t *)two_block, strlen(two_block), digest);
+    EXPECT_EQ(hex(digest, SHA256_DIGEST_LENGTH),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    sha512_Raw((const uint8_t *)"abc", 3, digest);
+    EXPECT_EQ(hex(digest, SHA512_DIGEST_LENGTH),
+              "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+              "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+}
+
+TEST(Crypto, SHA2MillionA) {
+    // one million 'a', fed in uneven pieces from a misaligned buffer so both
+    // the buffered path and the whole-block path are taken
+    static uint8_t data[1000001];
+    memset(data, 'a', sizeof(data));
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+
+    SHA256_CTX ctx256;
+    SHA512_CTX ctx512;
+    sha256_Init(&ctx256);
+    sha512_Init(&ctx512);
+    for (size_t off = 0, n = 1; off < 1000000; off += n, n = n * 3 % 1000 + 1) {
+        size_t len = std::min(n, (size_t)1000000 - off);
+        sha256_Update(&ctx256, data + 1 + off, len);
+        sha512_Update(&ctx512, data + 1 + off, len);
+    }
+
+    sha256_Final(&ctx256, digest);
+    EXPECT_EQ(hex(digest, SHA256_DIGEST_LENGTH),
+              "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    sha512_Final(&ctx512, digest);
+    EXPECT_EQ(hex(digest, SHA512_DIGEST_LENGTH),
+              "e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973eb"
+              "de0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b");
+}
@@ -1,5 +1,9 @@
 extern "C" {
+#include "keepkey/firmware/reset.h"
 #include "keepkey/firmware/storage.h"
+#include "keepkey/firmware/storage_log.h"
+#include "keepkey/board/flash_sim.h"
+#include "keepkey/board/keepkey_flash.h"
 #include "keepkey/board/keepkey_board.h"
 #include "types.pb.h"
 }
@@ -128,3 +132,190 @@ TEST(Storage, DumpNode) {
     EXPECT_EQ(dst.public_key.bytes[0], 0);
 #endif
 }
+
+TEST(Storage, CommitWearLeveling) {
+    ASSERT_TRUE(flash_sim_init(NULL));
+
+    // Blank flash: storage_init() commits a fresh config, moving off sector 1.
+    storage_init();
+    Allocation active;
+    ASSERT_TRUE(find_active_storage(&active));
+    EXPECT_EQ(active, FLASH_STORAGE2);
+
+    // Small changes are appended to the log in place.
+    FlashSimStats before, after;
+    flash_sim_stats(&before);
+    storage_set_label("wear");
+    storage_commit();
+    storage_increase_pin_fails();
+    flash_sim_stats(&after);
+    ASSERT_TRUE(find_active_storage(&active));
+    EXPECT_EQ(active, FLASH_STORAGE2);
+    EXPECT_EQ(memcmp(before.erases, after.erases, sizeof(after.erases)), 0);
+    EXPECT_LT(after.busy_us - before.busy_us, 10000u);
+
+    // Changing a secret rewrites the config into the next sector.
+    storage_set_pin("1234");
+    storage_commit();
+    ASSERT_TRUE(find_active_storage(&active));
+    EXPECT_EQ(active, FLASH_STORAGE3);
+
+    // Filling the log does too.
+    for (int i = 0; i < 2000; i++) {
+        storage_set_label(i % 2 ? "odd" : "even");
+        storage_commit();
+    }
+    ASSERT_TRUE(find_active_storage(&active));
+    flash_sim_stats(&after);
+    EXPECT_GT(after.erases[1] + after.erases[2] + after.erases[3], 4u);
+    EXPECT_LT(after.erases[1] + after.erases[2] + after.erases[3], 100u);
+    EXPECT_EQ(after.overwrites, 0u);
+
+    // Everything survives a reload from flash.
+    storage_reset();
+    storage_init();
+    EXPECT_STREQ(storage_get_label(), "odd");
+    EXPECT_EQ(storage_get_pin_fails(), 1u);
+    EXPECT_TRUE(storage_is_pin_correct("1234"));
+
+    flash_sim_close();
+}
+
+TEST(Storage, DeferredCommit) {
+    ASSERT_TRUE(flash_sim_init(NULL));
+    timer_init();
+    storage_init();
+
+    FlashSimStats before, after;
+    flash_sim_stats(&before);
+    storage_set_label("first");
+    storage_mark_dirty();
+    storage_set_label("second");
+    storage_mark_dirty();
+
+    // Nothing is written until the delay runs out or a barrier.
+    storage_poll();
+    flash_sim_stats(&after);
+    EXPECT_EQ(after.program_ops, before.program_ops);
+
+    storage_flush();
+    flash_sim_stats(&after);
+    EXPECT_GT(after.program_ops, before.program_ops);
+
+    // A second barrier has nothing left to write.
+    flash_sim_stats(&before);
+    storage_flush();
+    flash_sim_stats(&after);
+    EXPECT_EQ(after.program_ops, before.program_ops);
+
+    storage_reset();
+    storage_init();
+    EXPECT_STREQ(storage_get_label(), "second");
+
+    flash_sim_close();
+}
+
+TEST(Storage, SessionFlushesPendingSettings) {
+    ASSERT_TRUE(flash_sim_init(NULL));
+    timer_init();
+    storage_init();
+
+    storage_set_label("settings");
+    storage_mark_dirty();
+
+    // The reset lands the pending label before it edits shadow memory...
+    reset_init(false, 128, false, false, "english", "reset");
+    ASSERT_TRUE(reset_in_progress());
+
+    // ...and its own settings stay there until it has a seed.
+    FlashSimStats before, after;
+    flash_sim_stats(&before);
+    storage_poll();
+    flash_sim_stats(&after);
+    EXPECT_EQ(after.program_ops, before.program_ops);
+
+    storage_reset();
+    storage_init();
+    EXPECT_STREQ(storage_get_label(), "settings");
+
+    flash_sim_close();
+}
+
+TEST(Storage, MigrateSnapshot) {
+    ASSERT_TRUE(flash_sim_init(NULL));
+
+    // A version 10 sector: a bare snapshot, no log.
+    static ConfigFlash legacy;
+    memset(&legacy, 0, sizeof(legacy));
+    memcpy(legacy.meta.magic, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
+    legacy.storage.version = 10;
+    legacy.storage.has_label = true;
+    strcpy(legacy.storage.label, "legacy");
+    flash_unlock();
+    ASSERT_TRUE(flash_write_word(FLASH_STORAGE1, 0, sizeof(legacy),
+                                 (uint8_t *)&legacy));
+    flash_lock();
+
+    storage_init();
+    EXPECT_STREQ(storage_get_label(), "legacy");
+
+    // It was rewritten in the current format, which then takes log records.
+    Allocation active;
+    ASSERT_TRUE(find_active_storage(&active));
+    EXPECT_EQ(active, FLASH_STORAGE2);
+    const ConfigFlash *stor = (const ConfigFlash *)flash_write_helper(active);
+    EXPECT_EQ(stor->storage.version, (uint32_t)STORAGE_VERSION);
+
+    storage_set_label("current");
+    storage_commit();
+    storage_reset();
+    storage_init();
+    EXPECT_STREQ(storage_get_label(), "current");
+    ASSERT_TRUE(find_active_storage(&active));
+    EXPECT_EQ(active, FLASH_STORAGE2);
+
+    flash_sim_close();
+}
+
+TEST(Storage, LogRecord) {
+    static uint8_t from[300], to[300], replayed[300];
+    for (size_t i = 0; i < sizeof(from); i++)
+        from[i] = to[i] = i;
+    to[3] = 0xAA;
+    to[6] = 0xBB;   // close to the first change: same segment
+    to[200] = 0xCC;
+
+    uint32_t record[32];
+    size_t record_len;
+    ASSERT_TRUE(storage_log_encode(record, sizeof(record), from, from,
+                                   sizeof(from), &record_len));
+    EXPECT_EQ(record_len, 0u);
+    ASSERT_TRUE(storage_log_encode(record, sizeof(record), from, to,
+                                   sizeof(from), &record_len));
+    EXPECT_EQ(record_len, sizeof(StorageLogRecord) +
+                          2 * sizeof(StorageLogSegment) + 4 + 4);
+
+    // An erased log holding the record, then erased flash.
+    static uint8_t log[256];
+    memset(log, 0xFF, sizeof(log));
+    memcpy(log, record, record_len);
+    memcpy(replayed, from, sizeof(replayed));
+    size_t log_len;
+    EXPECT_TRUE(storage_log_replay(log, sizeof(log), replayed, sizeof(replayed),
+                                   &log_len));
+    EXPECT_EQ(log_len, record_len);
+    EXPECT_EQ(memcmp(replayed, to, sizeof(to)), 0);
+
+    // A torn record is dropped whole and stops further appends.
+    log[record_len - 1] = 0x00;
+    memcpy(replayed, from, sizeof(replayed));
+    EXPECT_FALSE(storage_log_replay(log, sizeof(log), replayed, sizeof(replayed),
+                                    &log_len));
+    EXPECT_EQ(log_len, 0u);
+    EXPECT_EQ(memcmp(replayed, from, sizeof(from)), 0);
+
+    // Too many changes for one record.
+    memset(to, 0, sizeof(to));
+    EXPECT_FALSE(storage_log_encode(record, sizeof(record), from, to,
+                                    sizeof(from), &record_len));
+}